@@ -386,7 +386,7 @@ namespace RFLink { namespace Wifi {
 
           #ifndef RFLINK_MQTT_DISABLED
           if(RFLink::Mqtt::params::enabled)
-            RFLink::Mqtt::reconnect(1, true);
+            RFLink::Mqtt::reconnect();
           #endif // RFLINK_MQTT_DISABLED
           if(RFLink::Serial2Net::params::enabled)
             RFLink::Serial2Net::restartServer();
@@ -10,10 +10,12 @@
 
 #include "1_Radio.h"
 #include "2_Signal.h"
+#include "5_Plugin.h"
 #include "6_MQTT.h"
 #include "9_Serial2Net.h"
 #include "10_Wifi.h"
 #include "12_Portal.h"
+#include "14_Flex.h"
 
 #if defined(DEBUG) || defined(RFLINK_DEBUG)
 #define DEBUG_RFLINK_CONFIG
@@ -42,6 +44,7 @@ namespace RFLink
             "signal",
             "radio",
             "serial2net",
+            "flex",
             "root" // this is always the last one and matches index SectionId::EOF_id
     };
 
@@ -61,7 +64,9 @@ namespace RFLink
             #endif // RFLINK_PORTAL_DISABLED
 #endif
             &RFLink::Signal::configItems[0],
+            &RFLink::Plugin::configItems[0],
             &RFLink::Radio::configItems[0],
+            &RFLink::Flex::configItems[0],
     };
 #define configItemListsSize (sizeof(configItemLists) / sizeof(ConfigItem *))
 
@@ -509,7 +514,11 @@ namespace RFLink
           Serial.println(F("Config file saved to flash."));
         }
         if (triggerUpdateCallbacks)
+        {
+          Signal::ScanTask::suspend(); // callbacks reconfigure the receiver and the slicers
           callbackMgr.execute();
+          Signal::ScanTask::resume();
+        }
       }
       else
       {
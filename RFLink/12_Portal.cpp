@@ -8,12 +8,14 @@
 #include <LittleFS.h>
 
 #include "2_Signal.h"
+#include "5_Plugin.h"
 #include "6_MQTT.h"
 #include "9_Serial2Net.h"
 #include "11_Config.h"
 #include "12_Portal.h"
 #include "10_Wifi.h"
 #include "13_OTA.h"
+#include "15_Capture.h"
 
 #if defined(ESP8266)
 #include "ESP8266WiFi.h"
@@ -84,7 +86,11 @@ namespace RFLink { namespace Portal {
           if(!checkHttpAuthentication(request))
             return;
 
-          DynamicJsonDocument output(1000);
+          size_t jsonSize = 1000;
+          #ifndef RFLINK_PLUGIN_STATS_DISABLED
+          jsonSize += RFLink::Plugin::getStatusJsonSize();
+          #endif
+          DynamicJsonDocument output(jsonSize);
 
           auto && obj = output.to<JsonObject>();
 
@@ -95,6 +101,9 @@ namespace RFLink { namespace Portal {
           RFLink::Mqtt::getStatusJsonString(obj);
           #endif // RFLINK_MQTT_DISABLED
           RFLink::Signal::getStatusJsonString(obj);
+          #ifndef RFLINK_PLUGIN_STATS_DISABLED
+          RFLink::Plugin::getStatusJsonString(obj);
+          #endif
           RFLink::Serial2Net::getStatusJsonString(obj);
 
           String buffer;
@@ -115,6 +124,21 @@ namespace RFLink { namespace Portal {
           RFLink::scheduleReboot(5);
         }
 
+        void serveApiCaptureGet(AsyncWebServerRequest *request) {
+          if(!checkHttpAuthentication(request))
+            return;
+
+          if(Capture::getMode() == Capture::Modes::ToFile) {
+            request->send(409, F("text/plain"), F("Recording in progress, stop it first"));
+            return;
+          }
+          if(!LittleFS.exists(CAPTURE_DEFAULT_FILE)) {
+            request->send(404, F("text/plain"), F("No capture recorded"));
+            return;
+          }
+          request->send(LittleFS, CAPTURE_DEFAULT_FILE, F("application/octet-stream"), true);
+        }
+
         void serveApiFirmwareHttpUpdateGetStatus(AsyncWebServerRequest *request){
           if(!checkHttpAuthentication(request))
             return;
@@ -379,6 +403,7 @@ namespace RFLink { namespace Portal {
           server.on(PSTR("/api/status"), HTTP_GET, serveApiStatusGet);
 
           server.on(PSTR("/api/reboot"), HTTP_GET, serveApiReboot);
+          server.on(PSTR("/api/capture"), HTTP_GET, serveApiCaptureGet);
           #ifndef FIRMWARE_UPGRADE_VIA_WEBSERVER_DISABLED
           server.on(PSTR("/api/firmware/update"), HTTP_POST, handleFirmwareUpdateFinalResponse,
                     handleFirmwareUpdateChunksReception);
@@ -0,0 +1,541 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "RFLink.h"
+#include "2_Signal.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+#include "14_Flex.h"
+
+namespace RFLink
+{
+  namespace Flex
+  {
+
+    namespace commands
+    {
+      const char list[] PROGMEM = "list";
+    }
+
+    namespace params
+    {
+      String rules;
+    }
+
+    const char json_name_rules[] = "rules";
+
+    Config::ConfigItem configItems[] = {
+        Config::ConfigItem(json_name_rules, Config::SectionId::Flex_id, "[]", paramsUpdatedCallback),
+        Config::ConfigItem()};
+
+    struct PulseBounds
+    {
+      uint16_t min; // microseconds
+      uint16_t max;
+    };
+
+    struct FieldStruct
+    {
+      char name[FLEX_FIELD_NAME_SIZE];
+      byte from;   // first bit, 0 is the first bit received
+      byte length; // 1..32 bits
+    };
+
+    struct RuleStruct
+    {
+      char name[FLEX_NAME_SIZE];
+      Signal::Modulation_enum modulation;
+      bool invert;                 // swaps 0 and 1 bits
+      uint16_t minPulses;          // accepted RawSignal.Number range
+      uint16_t maxPulses;
+      PulseBounds shortPulse;
+      PulseBounds longPulse;
+      PulseBounds markPulse;       // PPM only: marks between the data carrying spaces
+      byte preambleCount;
+      PulseBounds preamble[FLEX_MAX_PREAMBLE];
+      byte bitsCount;              // 0 means as many as received until the first gap
+      byte fieldsCount;
+      FieldStruct fields[FLEX_MAX_FIELDS];
+      int8_t idField;              // index in fields[] reported as ID=, -1 if none
+    };
+
+    static RuleStruct compiledRules[FLEX_MAX_RULES];
+    static byte compiledRulesCount = 0;
+    static uint16_t rulesMinPulses = 0; // smallest/largest RawSignal.Number accepted by any rule, to reject quickly
+    static uint16_t rulesMaxPulses = 0;
+    static volatile bool rulesUpdateRequired = false;
+
+    static byte bits[FLEX_MAX_BITS / 8];
+
+    static const char *const modulationNames[] = {
+        "unknown",
+        "pwm",
+        "ppm",
+        "manchester",
+    };
+    static_assert(sizeof(modulationNames) / sizeof(char *) == Signal::Modulation_enum::MODULATIONS_EOF, "modulationNames has missing/extra names, please compare with Modulation_enum enum declarations");
+
+    static PulseBounds makeBounds(unsigned long width_us, byte tolerance)
+    {
+      PulseBounds bounds;
+      bounds.min = (uint16_t)(width_us * (100 - tolerance) / 100);
+      unsigned long max = width_us * (100 + tolerance) / 100;
+      bounds.max = max > 0xFFFF ? 0xFFFF : (uint16_t)max;
+      return bounds;
+    }
+
+    static bool compileRule(JsonObject json, RuleStruct &rule, String &error)
+    {
+      const char *name = json[F("name")].as<const char *>();
+      if (name == nullptr || name[0] == 0)
+      {
+        error = F("'name' is missing");
+        return false;
+      }
+      strncpy(rule.name, name, FLEX_NAME_SIZE - 1);
+      rule.name[FLEX_NAME_SIZE - 1] = 0;
+
+      const char *modulation = json[F("modulation")].as<const char *>();
+      rule.modulation = Signal::Modulation_enum::Modulation_Unknown;
+      for (int i = Signal::Modulation_enum::Modulation_PWM; modulation != nullptr && i < Signal::Modulation_enum::MODULATIONS_EOF; i++)
+      {
+        if (strcasecmp(modulation, modulationNames[i]) == 0)
+          rule.modulation = (Signal::Modulation_enum)i;
+      }
+      if (rule.modulation == Signal::Modulation_enum::Modulation_Unknown)
+      {
+        error = F("'modulation' must be one of pwm, ppm or manchester");
+        return false;
+      }
+
+      unsigned long tolerance = json[F("tolerance")] | (unsigned long)FLEX_DEFAULT_TOLERANCE;
+      if (tolerance < 1 || tolerance > 90)
+      {
+        error = F("'tolerance' must be 1..90 percent");
+        return false;
+      }
+
+      unsigned long short_us = json[F("short")] | 0UL;
+      unsigned long long_us = json[F("long")] | (rule.modulation == Signal::Modulation_enum::Modulation_Manchester ? short_us * 2 : 0UL);
+      if (short_us == 0 || long_us <= short_us || long_us > 0xFFFF)
+      {
+        error = F("'short' and 'long' pulse widths are missing or invalid");
+        return false;
+      }
+      rule.shortPulse = makeBounds(short_us, tolerance);
+      rule.longPulse = makeBounds(long_us, tolerance);
+      if (rule.shortPulse.max >= rule.longPulse.min)
+      {
+        error = F("'short' and 'long' pulse widths overlap, lower the tolerance");
+        return false;
+      }
+      rule.markPulse = makeBounds(json[F("mark")] | short_us, tolerance);
+      rule.invert = json[F("invert")] | false;
+
+      JsonVariant pulses = json[F("pulses")];
+      if (pulses.is<JsonArray>() && pulses.size() == 2)
+      {
+        rule.minPulses = pulses[0] | 0U;
+        rule.maxPulses = pulses[1] | 0U;
+      }
+      else
+      {
+        rule.minPulses = pulses | 0U;
+        rule.maxPulses = rule.minPulses;
+      }
+      if (rule.minPulses < MIN_RAW_PULSES || rule.maxPulses < rule.minPulses || rule.maxPulses > RAW_BUFFER_SIZE)
+      {
+        error = F("'pulses' must be a pulse count or a [min, max] range of pulse counts");
+        return false;
+      }
+
+      rule.preambleCount = 0;
+      for (JsonVariant width : json[F("preamble")].as<JsonArray>())
+      {
+        if (rule.preambleCount >= FLEX_MAX_PREAMBLE)
+        {
+          error = F("'preamble' has too many pulses");
+          return false;
+        }
+        rule.preamble[rule.preambleCount++] = makeBounds(width | 0UL, tolerance);
+      }
+
+      unsigned long bitsCount = json[F("bits")] | 0UL;
+      if (bitsCount > FLEX_MAX_BITS)
+      {
+        error = F("'bits' is too large");
+        return false;
+      }
+      rule.bitsCount = bitsCount;
+
+      rule.fieldsCount = 0;
+      rule.idField = -1;
+      const char *idName = json[F("id")] | "id";
+      for (JsonObject jsonField : json[F("fields")].as<JsonArray>())
+      {
+        const char *fieldName = jsonField[F("name")].as<const char *>();
+        unsigned long from = jsonField[F("from")] | 0UL;
+        unsigned long length = jsonField[F("len")] | 0UL;
+
+        if (rule.fieldsCount >= FLEX_MAX_FIELDS)
+        {
+          error = F("'fields' has too many entries");
+          return false;
+        }
+        if (fieldName == nullptr || fieldName[0] == 0 || length < 1 || length > 32 || from + length > (bitsCount > 0 ? bitsCount : FLEX_MAX_BITS))
+        {
+          error = F("'fields' entries need a name, 'from' and 'len' (1..32) within the decoded bits");
+          return false;
+        }
+
+        FieldStruct &field = rule.fields[rule.fieldsCount];
+        strncpy(field.name, fieldName, FLEX_FIELD_NAME_SIZE - 1);
+        field.name[FLEX_FIELD_NAME_SIZE - 1] = 0;
+        field.from = from;
+        field.length = length;
+        if (strcasecmp(fieldName, idName) == 0)
+          rule.idField = rule.fieldsCount;
+        rule.fieldsCount++;
+      }
+      if (rule.fieldsCount == 0)
+      {
+        error = F("'fields' is missing");
+        return false;
+      }
+
+      return true;
+    }
+
+    static void compileRules()
+    {
+      rulesUpdateRequired = false;
+      compiledRulesCount = 0;
+      rulesMinPulses = 0xFFFF;
+      rulesMaxPulses = 0;
+
+      DynamicJsonDocument json(FLEX_RULES_JSON_BUFFER_SIZE);
+      if (deserializeJson(json, params::rules.c_str()) != DeserializationError::Ok || !json.is<JsonArray>())
+      {
+        Serial.println(F("Flex: rules are not a valid JSON array, no rule loaded"));
+        PluginSetPulseRange(FLEX_PLUGIN_ID, rulesMinPulses, rulesMaxPulses);
+        return;
+      }
+
+      int index = 0;
+      String error;
+      for (JsonObject jsonRule : json.as<JsonArray>())
+      {
+        if (compiledRulesCount >= FLEX_MAX_RULES)
+        {
+          Serial.printf_P(PSTR("Flex: only %i rules are supported, the next ones are ignored\r\n"), FLEX_MAX_RULES);
+          break;
+        }
+
+        RuleStruct &rule = compiledRules[compiledRulesCount];
+        if (!compileRule(jsonRule, rule, error))
+        {
+          Serial.printf_P(PSTR("Flex: rule #%i is ignored, %s\r\n"), index, error.c_str());
+        }
+        else
+        {
+          if (rule.minPulses < rulesMinPulses)
+            rulesMinPulses = rule.minPulses;
+          if (rule.maxPulses > rulesMaxPulses)
+            rulesMaxPulses = rule.maxPulses;
+          compiledRulesCount++;
+        }
+        index++;
+      }
+
+      Serial.printf_P(PSTR("Flex: %i rule(s) loaded\r\n"), compiledRulesCount);
+      PluginSetPulseRange(FLEX_PLUGIN_ID, rulesMinPulses, rulesMaxPulses); // none without rules
+    }
+
+    void setup()
+    {
+      refreshParametersFromConfig(false);
+      compileRules();
+    }
+
+    void paramsUpdatedCallback()
+    {
+      refreshParametersFromConfig();
+    }
+
+    void refreshParametersFromConfig(bool triggerChanges)
+    {
+      Config::ConfigItem *item;
+      bool changesDetected = false;
+
+      item = Config::findConfigItem(json_name_rules, Config::SectionId::Flex_id);
+      if (params::rules != item->getCharValue())
+      {
+        changesDetected = true;
+        params::rules = item->getCharValue();
+      }
+
+      // Rules are compiled again at next decode(), from the context which is decoding signals.
+      // Until then the dispatch index must give it every frame, whatever the new rules accept.
+      if (triggerChanges && changesDetected)
+      {
+        Serial.println(F("Flex parameters have changed."));
+        rulesUpdateRequired = true;
+        PluginSetPulseRange(FLEX_PLUGIN_ID, 0, 0xFFFF);
+      }
+    }
+
+    /**
+     * @return 0 for a short pulse, 1 for a long one, -1 for anything else (gap, noise)
+     * */
+    static inline int8_t classifyPulse(const RuleStruct &rule, uint16_t pulse)
+    {
+      if (pulse >= rule.shortPulse.min && pulse <= rule.shortPulse.max)
+        return 0;
+      if (pulse >= rule.longPulse.min && pulse <= rule.longPulse.max)
+        return 1;
+      return -1;
+    }
+
+    static inline uint16_t pulseAt(int index)
+    {
+      return Signal::RawSignal.Pulses[index] * Signal::RawSignal.Multiply;
+    }
+
+    static inline void appendBit(int &count, byte bit)
+    {
+      if (bit)
+        bits[count >> 3] |= 0x80 >> (count & 7);
+      count++;
+    }
+
+    /**
+     * Every bit is a pair of pulses, short+long being 0 and long+short being 1.
+     * The space of the last bit is usually merged with the gap which ends the frame.
+     * */
+    static int decodePWM(const RuleStruct &rule, int start, int maxBits)
+    {
+      int count = 0;
+
+      for (int i = start; i <= Signal::RawSignal.Number && count < maxBits; i += 2)
+      {
+        int8_t mark = classifyPulse(rule, pulseAt(i));
+        if (mark < 0)
+          break;
+
+        int8_t space = i < Signal::RawSignal.Number ? classifyPulse(rule, pulseAt(i + 1)) : -1;
+        if (space == mark)
+          return -1;
+
+        appendBit(count, mark ^ rule.invert);
+        if (space < 0)
+          break;
+      }
+      return count;
+    }
+
+    /**
+     * Marks have a constant width, the space after each of them being short for 0 and long for 1.
+     * */
+    static int decodePPM(const RuleStruct &rule, int start, int maxBits)
+    {
+      int count = 0;
+
+      for (int i = start; i < Signal::RawSignal.Number && count < maxBits; i += 2)
+      {
+        uint16_t mark = pulseAt(i);
+        if (mark < rule.markPulse.min || mark > rule.markPulse.max)
+          return -1;
+
+        int8_t space = classifyPulse(rule, pulseAt(i + 1));
+        if (space < 0)
+          break; // last mark is followed by the gap
+
+        appendBit(count, space ^ rule.invert);
+      }
+      return count;
+    }
+
+    /**
+     * Short pulses are half a bit, long ones a full bit. A high half followed by a low half is a 1.
+     * If the first half seen is not the start of a bit it is skipped.
+     * */
+    static int decodeManchester(const RuleStruct &rule, int start, int maxBits)
+    {
+      int count = 0;
+      int8_t firstHalf = -1;
+
+      for (int i = start; i <= Signal::RawSignal.Number && count < maxBits; i++)
+      {
+        int8_t width = classifyPulse(rule, pulseAt(i));
+        bool lastPulse = (width < 0);
+        if (lastPulse)
+        {
+          if (firstHalf < 0)
+            break;
+          width = 0; // only the half bit we are waiting for is part of the gap
+        }
+
+        byte level = i & 1; // marks are on odd indexes
+        for (int8_t half = 0; half <= width && count < maxBits; half++)
+        {
+          if (firstHalf < 0)
+            firstHalf = level;
+          else if (firstHalf == level)
+          {
+            if (count > 0)
+              return -1;
+            firstHalf = level; // we started in the middle of a bit
+          }
+          else
+          {
+            appendBit(count, firstHalf ^ rule.invert);
+            firstHalf = -1;
+          }
+        }
+
+        if (lastPulse)
+          break;
+      }
+      return count;
+    }
+
+    static unsigned long getField(const FieldStruct &field)
+    {
+      unsigned long value = 0;
+      for (int b = field.from; b < field.from + field.length; b++)
+        value = (value << 1) | ((bits[b >> 3] >> (7 - (b & 7))) & 1);
+      return value;
+    }
+
+    static unsigned long hashBits(byte ruleIndex, int count)
+    {
+      unsigned long hash = 2166136261UL ^ ruleIndex; // FNV-1a
+      for (int i = 0; i < (count + 7) / 8; i++)
+      {
+        hash ^= bits[i];
+        hash *= 16777619UL;
+      }
+      return hash;
+    }
+
+    static bool matchRule(byte ruleIndex)
+    {
+      const RuleStruct &rule = compiledRules[ruleIndex];
+
+      if (Signal::RawSignal.Number < rule.minPulses || Signal::RawSignal.Number > rule.maxPulses)
+        return false;
+
+      for (byte i = 0; i < rule.preambleCount; i++)
+      {
+        uint16_t pulse = pulseAt(i + 1);
+        if (pulse < rule.preamble[i].min || pulse > rule.preamble[i].max)
+          return false;
+      }
+
+      memset(bits, 0, sizeof(bits));
+      int maxBits = rule.bitsCount > 0 ? rule.bitsCount : FLEX_MAX_BITS;
+      int start = 1 + rule.preambleCount;
+      int count;
+
+      switch (rule.modulation)
+      {
+      case Signal::Modulation_enum::Modulation_PWM:
+        count = decodePWM(rule, start, maxBits);
+        break;
+      case Signal::Modulation_enum::Modulation_PPM:
+        count = decodePPM(rule, start, maxBits);
+        break;
+      case Signal::Modulation_enum::Modulation_Manchester:
+        count = decodeManchester(rule, start, maxBits);
+        break;
+      default:
+        return false;
+      }
+
+      if (count <= 0 || (rule.bitsCount > 0 && count != rule.bitsCount))
+        return false;
+      for (byte f = 0; f < rule.fieldsCount; f++)
+      {
+        if (rule.fields[f].from + rule.fields[f].length > count)
+          return false;
+      }
+
+      //==================================================================================
+      // Prevent repeating signals from showing up
+      //==================================================================================
+      unsigned long id = rule.idField >= 0 ? getField(rule.fields[rule.idField]) : 0;
+      if (Signal::RepeatCache::isRepeat(id, hashBits(ruleIndex, count)))
+        return true; // already seen the RF packet recently
+      //==================================================================================
+      // Output
+      //==================================================================================
+      display_Header();
+      display_Name(rule.name);
+      if (rule.idField >= 0)
+        display_IDn(id, (rule.fields[rule.idField].length > 24) ? 8 : (rule.fields[rule.idField].length + 7) / 8 * 2);
+
+      for (byte f = 0; f < rule.fieldsCount; f++)
+      {
+        if (f != rule.idField)
+          display_Field(rule.fields[f].name, getField(rule.fields[f]));
+      }
+      display_Footer();
+      return true;
+    }
+
+    bool decode()
+    {
+      if (rulesUpdateRequired)
+        compileRules();
+
+      if (compiledRulesCount == 0)
+        return false;
+      if (Signal::RawSignal.Number < rulesMinPulses || Signal::RawSignal.Number > rulesMaxPulses)
+        return false;
+
+      for (byte r = 0; r < compiledRulesCount; r++)
+      {
+        if (matchRule(r))
+          return true;
+      }
+      return false;
+    }
+
+    void executeCliCommand(char *cmd)
+    {
+      char *separatorPtr = strchr(cmd, ';');
+      int commandSize = separatorPtr - cmd;
+
+      if (separatorPtr == nullptr)
+        commandSize = strlen(cmd);
+
+      if (strncasecmp_P(cmd, commands::list, commandSize) == 0)
+      {
+        if (rulesUpdateRequired)
+          compileRules();
+
+        sprintf_P(printBuf, PSTR("30;flex;rules=%i;"), compiledRulesCount);
+        sendRawPrint(printBuf, true);
+        for (byte r = 0; r < compiledRulesCount; r++)
+        {
+          const RuleStruct &rule = compiledRules[r];
+          snprintf_P(printBuf, sizeof(printBuf), PSTR("30;flex;rule=%i;name=%s;modulation=%s;pulses=%u-%u;short=%u-%u;long=%u-%u;preamble=%i;bits=%i;fields=%i;"),
+                     r, rule.name, modulationNames[rule.modulation], rule.minPulses, rule.maxPulses,
+                     rule.shortPulse.min, rule.shortPulse.max, rule.longPulse.min, rule.longPulse.max,
+                     rule.preambleCount, rule.bitsCount, rule.fieldsCount);
+          sendRawPrint(printBuf, true);
+        }
+      }
+      else
+      {
+        Serial.printf_P(PSTR("Error : unknown command '%s'\r\n"), cmd);
+      }
+    }
+
+  } // end of Flex namespace
+} // end of RFLink namespace
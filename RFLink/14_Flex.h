@@ -0,0 +1,54 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _14_FLEX_H_
+#define _14_FLEX_H_
+
+#include <Arduino.h>
+#include "11_Config.h"
+
+#define FLEX_MAX_RULES 8                  // Number of rules kept after compilation, extra ones are ignored
+#define FLEX_MAX_PREAMBLE 8               // Pulses which must be found before the data bits
+#define FLEX_MAX_FIELDS 6                 // Fields reported for each rule
+#define FLEX_MAX_BITS 128                 // Data bits decoded for each rule
+#define FLEX_NAME_SIZE 17                 // Rule name, as reported on the second field of the output
+#define FLEX_FIELD_NAME_SIZE 9
+#define FLEX_DEFAULT_TOLERANCE 25         // Pulse width tolerance in percent when a rule has none
+#define FLEX_RULES_JSON_BUFFER_SIZE 2048
+#define FLEX_PLUGIN_ID 100               // Plugin_100 runs the rules
+
+namespace RFLink
+{
+  namespace Flex
+  {
+    /**
+     * Decodes simple OOK protocols described by JSON rules from the 'flex' config section, without reflashing.
+     * The rules are compiled into FLEX_MAX_RULES matcher tables (pulse bounds, preamble, field bit ranges) when
+     * the configuration is loaded or changed, so that decoding never has to look at JSON.
+     * */
+
+    namespace params
+    {
+      extern String rules; // JSON array of rules, see CLI_Reference_Guide.md
+    }
+
+    extern Config::ConfigItem configItems[];
+
+    void setup();
+    void paramsUpdatedCallback();
+    void refreshParametersFromConfig(bool triggerChanges = true);
+
+    /**
+     * Tries every compiled rule against RawSignal and writes the output of the first one which matches
+     * @return true if a rule has matched
+     * */
+    bool decode();
+
+    void executeCliCommand(char *cmd);
+  }
+}
+
+#endif // _14_FLEX_H_
@@ -0,0 +1,349 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <time.h>
+#include <Arduino.h>
+#ifdef ESP8266
+#include <LittleFS.h>
+#else
+#include <FS.h>
+#include <LittleFS.h>
+#endif
+#include "RFLink.h"
+#include "2_Signal.h"
+#include "15_Capture.h"
+
+namespace RFLink
+{
+  namespace Capture
+  {
+
+    namespace commands
+    {
+      const char start[] PROGMEM = "start";
+      const char stream[] PROGMEM = "stream";
+      const char stop[] PROGMEM = "stop";
+      const char status[] PROGMEM = "status";
+    }
+
+    namespace counters
+    {
+      unsigned long int recordedFramesCount = 0;
+      unsigned long int droppedFramesCount = 0;
+      unsigned long int recordedBytesCount = 0;
+    }
+
+    static const char magic[] = {'R', 'F', 'L', 'C'};
+    static const char *modeNames[] = {"stopped", "file", "stream"};
+
+    static Modes mode = Modes::Stopped;
+    static File file;
+    static unsigned long lastFrame_ms;
+    static uint8_t buffer[CAPTURE_FRAME_MAX_SIZE];
+    static volatile size_t pendingSize = 0; // frame encoded in buffer by record(), waiting for mainLoop()
+    static unsigned long pendingTime_ms;
+
+    static inline size_t putVarint(uint8_t *buffer, unsigned long value)
+    {
+      size_t size = 0;
+      while (value >= 0x80)
+      {
+        buffer[size++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+      }
+      buffer[size++] = value;
+      return size;
+    }
+
+    /**
+     * @return bytes used by the varint at data, 0 if it is truncated or longer than an unsigned long
+     * */
+    static inline size_t getVarint(const uint8_t *data, size_t size, unsigned long &value)
+    {
+      value = 0;
+      for (size_t i = 0; i < size && i * 7 < sizeof(value) * 8; i++)
+      {
+        value |= (unsigned long)(data[i] & 0x7F) << (i * 7);
+        if ((data[i] & 0x80) == 0)
+          return i + 1;
+      }
+      return 0;
+    }
+
+    size_t encodeHeader(uint8_t *buffer, unsigned long unixTime_s, unsigned long start_ms)
+    {
+      memcpy(buffer, magic, sizeof(magic));
+      size_t size = sizeof(magic);
+      buffer[size++] = CAPTURE_FORMAT_VERSION;
+      size += putVarint(&buffer[size], unixTime_s);
+      size += putVarint(&buffer[size], start_ms);
+      return size;
+    }
+
+    size_t encodeFrame(uint8_t *buffer, const Signal::RawSignalStruct &signal, byte slicer, unsigned long previous_ms)
+    {
+      int number = signal.Number;
+      if (number < 0)
+        number = 0;
+      if (number > RAW_BUFFER_SIZE)
+        number = RAW_BUFFER_SIZE;
+
+      int rssi = (int)signal.rssi;
+      if (rssi < -128)
+        rssi = -128;
+      if (rssi > 127)
+        rssi = 127;
+
+      size_t size = putVarint(buffer, signal.Time - previous_ms);
+      buffer[size++] = slicer;
+      buffer[size++] = (uint8_t)signal.endReason;
+      buffer[size++] = (uint8_t)(int8_t)rssi;
+      size += putVarint(&buffer[size], number);
+      for (int i = 1; i <= number; i++)
+      {
+        unsigned long pulse = (unsigned long)signal.Pulses[i] * signal.Multiply;
+        size += putVarint(&buffer[size], pulse > 0x1FFFFF ? 0x1FFFFF : pulse); // 3 bytes at most
+      }
+      return size;
+    }
+
+    size_t decodeHeader(const uint8_t *data, size_t size, unsigned long &unixTime_s, unsigned long &start_ms)
+    {
+      if (size < sizeof(magic) + 1 || memcmp(data, magic, sizeof(magic)) != 0 || data[sizeof(magic)] != CAPTURE_FORMAT_VERSION)
+        return 0;
+
+      size_t used = sizeof(magic) + 1;
+      size_t length = getVarint(&data[used], size - used, unixTime_s);
+      if (length == 0)
+        return 0;
+      used += length;
+      length = getVarint(&data[used], size - used, start_ms);
+      if (length == 0)
+        return 0;
+      return used + length;
+    }
+
+    size_t decodeFrame(const uint8_t *data, size_t size, unsigned long previous_ms, FrameInfo &info, Signal::RawSignalStruct &signal)
+    {
+      unsigned long value;
+      size_t used = getVarint(data, size, value);
+      if (used == 0 || used + 4 > size)
+        return 0;
+      info.time_ms = previous_ms + value;
+      info.slicer = data[used++];
+      info.endReason = data[used] < Signal::EndReasons::REASONS_EOF ? (Signal::EndReasons)data[used] : Signal::EndReasons::Unknown;
+      used++;
+      int8_t rssi = (int8_t)data[used++];
+
+      size_t length = getVarint(&data[used], size - used, value);
+      if (length == 0 || value > RAW_BUFFER_SIZE)
+        return 0;
+      used += length;
+
+      signal.Number = value;
+      signal.Repeats = 0;
+      signal.Delay = 0;
+      signal.Multiply = Signal::params::sample_rate;
+      signal.Time = info.time_ms;
+      signal.rssi = rssi;
+      signal.endReason = info.endReason;
+      for (int i = 1; i <= signal.Number; i++)
+      {
+        length = getVarint(&data[used], size - used, value);
+        if (length == 0)
+          return 0;
+        used += length;
+        value /= signal.Multiply;
+        signal.Pulses[i] = value > 0xFFFF ? 0xFFFF : value;
+      }
+      return used;
+    }
+
+    static void printHex(const char *prefix, const uint8_t *data, size_t size)
+    {
+      static const char digits[] = "0123456789abcdef";
+      char chunk[65];
+
+      sendRawPrint(prefix);
+      while (size > 0)
+      {
+        size_t count = size > (sizeof(chunk) - 1) / 2 ? (sizeof(chunk) - 1) / 2 : size;
+        for (size_t i = 0; i < count; i++)
+        {
+          chunk[2 * i] = digits[data[i] >> 4];
+          chunk[2 * i + 1] = digits[data[i] & 0x0F];
+        }
+        chunk[2 * count] = 0;
+        sendRawPrint(chunk);
+        data += count;
+        size -= count;
+      }
+      sendRawPrint(";", true);
+    }
+
+    static void printStatus(const char *reason = nullptr)
+    {
+      snprintf_P(printBuf, sizeof(printBuf), PSTR("30;capture;mode=%s;frames=%lu;dropped=%lu;bytes=%lu;"), modeNames[mode],
+                 counters::recordedFramesCount, counters::droppedFramesCount, counters::recordedBytesCount);
+      sendRawPrint(printBuf);
+      if (reason != nullptr)
+      {
+        sendRawPrint(F("reason="));
+        sendRawPrint(reason);
+        sendRawPrint(F(";"));
+      }
+      sendRawPrintln();
+    }
+
+    static bool start(Modes newMode, const char *path)
+    {
+      stop();
+
+      unsigned long unixTime_s = time(nullptr);
+      if (unixTime_s < 1000000000UL) // not synchronised yet
+        unixTime_s = 0;
+      lastFrame_ms = millis();
+      size_t size = encodeHeader(buffer, unixTime_s, lastFrame_ms);
+
+      if (newMode == Modes::ToFile)
+      {
+        file = LittleFS.open(path, "w");
+        if (!file || file.write(buffer, size) != size)
+        {
+          Serial.printf_P(PSTR("Error : failed to create capture file '%s'\r\n"), path);
+          if (file)
+            file.close();
+          return false;
+        }
+      }
+      else
+        printHex("20;XX;CAPTURE;Header=", buffer, size);
+
+      counters::recordedFramesCount = 0;
+      counters::droppedFramesCount = 0;
+      counters::recordedBytesCount = size;
+      mode = newMode;
+      return true;
+    }
+
+    bool startFile(const char *path)
+    {
+      return start(Modes::ToFile, path);
+    }
+
+    bool startStream()
+    {
+      return start(Modes::ToStream, nullptr);
+    }
+
+    void stop()
+    {
+      mainLoop(); // the last frame belongs to this recording
+      if (mode == Modes::ToFile)
+        file.close();
+      mode = Modes::Stopped;
+    }
+
+    Modes getMode()
+    {
+      return mode;
+    }
+
+    void record(const Signal::RawSignalStruct &signal)
+    {
+      if (mode == Modes::Stopped)
+        return;
+
+      byte slicer = Signal::params::async_mode_enabled ? CAPTURE_SLICER_ASYNC : (byte)Signal::runtime::appliedSlicer;
+      if (pendingSize != 0)
+      { // previous frame not written yet, the main loop is busy
+        counters::droppedFramesCount++;
+        return;
+      }
+
+      pendingTime_ms = signal.Time;
+      pendingSize = encodeFrame(buffer, signal, slicer, lastFrame_ms);
+    }
+
+    void mainLoop()
+    {
+      size_t size = pendingSize;
+      if (size == 0)
+        return;
+
+      Signal::ScanTask::lock(); // record() must not see the mode change, stop() already holds it
+
+      if (mode == Modes::ToFile)
+      {
+        const char *reason = nullptr;
+        if (counters::recordedBytesCount + size > CAPTURE_MAX_FILE_SIZE)
+          reason = "full";
+        else if (file.write(buffer, size) != size)
+          reason = "write_error";
+
+        if (reason != nullptr)
+        { // keep what was written so far, rather than trying again and dropping every following frame
+          counters::droppedFramesCount++;
+          file.close();
+          mode = Modes::Stopped;
+          pendingSize = 0;
+          Signal::ScanTask::unlock();
+          printStatus(reason);
+          return;
+        }
+      }
+      else if (mode == Modes::ToStream)
+        printHex("20;XX;CAPTURE;Frame=", buffer, size);
+
+      lastFrame_ms = pendingTime_ms;
+      counters::recordedFramesCount++;
+      counters::recordedBytesCount += size;
+      pendingSize = 0; // last, buffer is free again for record()
+
+      Signal::ScanTask::unlock();
+    }
+
+    void executeCliCommand(char *cmd)
+    {
+      char *separatorPtr = strchr(cmd, ';');
+      int commandSize = separatorPtr - cmd;
+
+      if (separatorPtr == nullptr)
+        commandSize = strlen(cmd);
+
+      if (strncasecmp_P(cmd, commands::start, commandSize) == 0)
+      {
+        const char *path = CAPTURE_DEFAULT_FILE;
+        char *pathEnd = separatorPtr == nullptr ? nullptr : strchr(separatorPtr + 1, ';');
+        if (pathEnd != nullptr && pathEnd > separatorPtr + 1)
+        {
+          *pathEnd = 0;
+          path = separatorPtr + 1;
+        }
+        if (startFile(path))
+        {
+          snprintf_P(printBuf, sizeof(printBuf), PSTR("30;capture;recording=%s;"), path);
+          sendRawPrint(printBuf, true);
+        }
+      }
+      else if (strncasecmp_P(cmd, commands::stream, commandSize) == 0)
+      {
+        startStream();
+      }
+      else if (strncasecmp_P(cmd, commands::stop, commandSize) == 0 || strncasecmp_P(cmd, commands::status, commandSize) == 0)
+      {
+        if (strncasecmp_P(cmd, commands::stop, commandSize) == 0)
+          stop();
+        printStatus();
+      }
+      else
+      {
+        Serial.printf_P(PSTR("Error : unknown command '%s'\r\n"), cmd);
+      }
+    }
+
+  } // end of Capture namespace
+} // end of RFLink namespace
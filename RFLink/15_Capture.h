@@ -0,0 +1,107 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef _15_CAPTURE_H_
+#define _15_CAPTURE_H_
+
+#include <Arduino.h>
+#include "2_Signal.h"
+
+#define CAPTURE_DEFAULT_FILE "/capture.rfc"
+#define CAPTURE_MAX_FILE_SIZE 65536          // Recording to a file stops there, to keep room on LittleFS
+#define CAPTURE_FORMAT_VERSION 1
+#define CAPTURE_SLICER_ASYNC 0xFF            // Slicer id of the frames from the async receiver
+#define CAPTURE_SLICER_UNKNOWN 0xFE          // Frames converted from a debug log
+#define CAPTURE_FRAME_HEADER_SIZE 16         // Worst case of the fields before the pulses
+#define CAPTURE_FRAME_MAX_SIZE (CAPTURE_FRAME_HEADER_SIZE + 3 * (RAW_BUFFER_SIZE + 1))
+
+namespace RFLink
+{
+  namespace Capture
+  {
+    /**
+     * Records received frames in a compact binary form, for offline analysis and replay on a workstation
+     * (see tools/native/README.md). All integers are unsigned LEB128 varints unless stated otherwise.
+     *
+     * File header:
+     *   "RFLC", version (1 byte), unix time of the recording start in s (0 if unknown),
+     *   millis() at the recording start
+     * Each frame:
+     *   ms since the previous frame (or the recording start), slicer id (1 byte, Signal::Slicer_enum or
+     *   CAPTURE_SLICER_ASYNC), end reason (1 byte, Signal::EndReasons), RSSI in dBm (1 byte, signed),
+     *   pulse count, then every pulse in microseconds
+     *
+     * A frame typically takes 2 bytes per pulse, against 4 to 5 characters in a "20;XX;DEBUG;Pulses=" line.
+     * */
+
+    enum Modes
+    {
+      Stopped,
+      ToFile,   // frames are appended to a LittleFS file
+      ToStream, // frames are printed as "20;XX;CAPTURE;Frame=<hex>;" lines to the serial and network clients
+    };
+
+    struct FrameInfo
+    {
+      unsigned long time_ms; // millis() of the device when the frame was received
+      byte slicer;
+      Signal::EndReasons endReason;
+    };
+
+    namespace counters
+    {
+      extern unsigned long int recordedFramesCount;
+      extern unsigned long int droppedFramesCount; // main loop too slow, or the frame which stopped a full or failing file
+      extern unsigned long int recordedBytesCount;
+    }
+
+    Modes getMode();
+
+    /**
+     * Starts a new recording in path, replacing the file if it exists
+     * */
+    bool startFile(const char *path = CAPTURE_DEFAULT_FILE);
+    bool startStream();
+    void stop();
+
+    /**
+     * Called by Signal::ScanEvent() for every frame received, before the plugins: it only encodes the frame,
+     * which is written or streamed later by mainLoop(). A frame received while the previous one is still
+     * pending is dropped.
+     * */
+    void record(const Signal::RawSignalStruct &signal);
+    /**
+     * Writes the pending frame to the file or prints it, from the main loop so that neither LittleFS nor
+     * a slow serial line delays decoding. Recording to a file stops, with a "30;capture;...;reason=" line,
+     * when the file reaches CAPTURE_MAX_FILE_SIZE or a write fails.
+     * */
+    void mainLoop();
+
+    /**
+     * @return size of the file header written in buffer, which must hold CAPTURE_FRAME_HEADER_SIZE bytes
+     * */
+    size_t encodeHeader(uint8_t *buffer, unsigned long unixTime_s, unsigned long start_ms);
+    /**
+     * @return size of the frame written in buffer, which must hold CAPTURE_FRAME_MAX_SIZE bytes
+     * */
+    size_t encodeFrame(uint8_t *buffer, const Signal::RawSignalStruct &signal, byte slicer, unsigned long previous_ms);
+
+    /**
+     * @return size of the file header at data, 0 if this is not a capture file
+     * */
+    size_t decodeHeader(const uint8_t *data, size_t size, unsigned long &unixTime_s, unsigned long &start_ms);
+    /**
+     * Reads the frame at data into signal, pulses divided by the current sample rate as for the testRF command.
+     * previous_ms is the time of the previous frame (the recording start for the first one).
+     * @return size of the frame, 0 if it is truncated or malformed
+     * */
+    size_t decodeFrame(const uint8_t *data, size_t size, unsigned long previous_ms, FrameInfo &info, Signal::RawSignalStruct &signal);
+
+    void executeCliCommand(char *cmd);
+  }
+}
+
+#endif // _15_CAPTURE_H_
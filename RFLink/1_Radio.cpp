@@ -1259,7 +1259,9 @@ namespace RFLink { namespace Radio  {
         time_t now = time(nullptr);
         if(now > nextEnablementAttemptTime) {
           nextEnablementAttemptTime = now + 5;
+          Signal::ScanTask::suspend();
           initializeHardware(hardware, true);
+          Signal::ScanTask::resume();
         }
       }
     }
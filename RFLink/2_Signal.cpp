@@ -10,12 +10,15 @@
 #include "2_Signal.h"
 #include "5_Plugin.h"
 #include "4_Display.h"
+#include "15_Capture.h"
+
+#ifdef RFLINK_SIGNAL_TASK_ENABLED
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
 
-unsigned long SignalCRC = 0L;   // holds the bitstream value for some plugins to identify RF repeats
-unsigned long SignalCRC_1 = 0L; // holds the previous SignalCRC (for mixed burst protocols)
 byte SignalHash = 0L;           // holds the processed plugin number
-byte SignalHashPrevious = 0L;   // holds the last processed plugin number
-unsigned long RepeatingTimer = 0L;
 
 namespace RFLink
 {
@@ -23,6 +26,8 @@ namespace RFLink
   {
 
     RawSignalStruct RawSignal = {0, 0, 0, 0, 0UL, false, -9999.0F, EndReasons::Unknown}; // current message
+    FrameFeaturesStruct FrameFeatures;
+    SubFramesStruct SubFrames;
 
     #define SLICER_DEFAULT_RFM69 Slicer_enum::Legacy
     #define SLICER_DEFAULT_CC1101 Slicer_enum::Legacy
@@ -40,6 +45,13 @@ namespace RFLink
     namespace counters {
       unsigned long int receivedSignalsCount;
       unsigned long int successfullyDecodedSignalsCount;
+      unsigned long int asyncQueueDroppedSignalsCount;
+      unsigned long int repeatsSuppressedCount;
+      unsigned long int subFramesDecodedCount;
+      #ifdef RFLINK_SIGNAL_TASK_ENABLED
+      unsigned long int scanTaskStalledTime_ms;
+      unsigned long int scanTaskPrintDroppedCount;
+      #endif
     }
 
     namespace runtime {
@@ -59,6 +71,7 @@ namespace RFLink
       unsigned long int signal_end_timeout;
       unsigned long int signal_repeat_time;
       unsigned long int scan_high_time;
+      unsigned long int poll_budget;
 
       Slicer_enum slicer = Slicer_enum::Default;
     }
@@ -73,6 +86,7 @@ namespace RFLink
     const char json_name_signal_repeat_time[] = "signal_repeat_time";
     const char json_name_scan_high_time[] = "scan_high_time";
     const char json_name_slicer[] = "slicer";
+    const char json_name_poll_budget[] = "poll_budget";
 
     Config::ConfigItem configItems[] = {
             Config::ConfigItem(json_name_async_mode_enabled, Config::SectionId::Signal_id, false, paramsUpdatedCallback),
@@ -86,6 +100,7 @@ namespace RFLink
             Config::ConfigItem(json_name_scan_high_time, Config::SectionId::Signal_id, SCAN_HIGH_TIME_MS, paramsUpdatedCallback),
 
             Config::ConfigItem(json_name_slicer, Config::SectionId::Signal_id, Slicer_enum::Default, paramsUpdatedCallback, true),
+            Config::ConfigItem(json_name_poll_budget, Config::SectionId::Signal_id, SIGNAL_POLL_BUDGET_US, paramsUpdatedCallback),
 
             Config::ConfigItem()};
 
@@ -163,6 +178,12 @@ namespace RFLink
         params::scan_high_time = item->getLongIntValue();
       }
 
+      item = Config::findConfigItem(json_name_poll_budget, Config::SectionId::Signal_id);
+      if (item->getUnsignedLongIntValue() != params::poll_budget)
+      {
+        changesDetected = true;
+        params::poll_budget = item->getLongIntValue();
+      }
 
       long int value;
       item = Config::findConfigItem(json_name_slicer, Config::SectionId::Signal_id);
@@ -205,6 +226,7 @@ namespace RFLink
     void setup()
     {
       params::async_mode_enabled = false;
+      RepeatCache::reset();
       refreshParametersFromConfig();
     }
 
@@ -590,79 +612,395 @@ namespace RFLink
       return false;
     }
 
-    boolean ScanEvent()
+#ifdef ESP32
+    // ISR may be attached on the other core than the one calling ScanEvent(), interrupts masking is not enough
+    static portMUX_TYPE asyncScannerMux = portMUX_INITIALIZER_UNLOCKED;
+#define ASYNC_SCANNER_ENTER_CRITICAL() portENTER_CRITICAL(&asyncScannerMux)
+#define ASYNC_SCANNER_EXIT_CRITICAL() portEXIT_CRITICAL(&asyncScannerMux)
+#define ASYNC_SCANNER_ENTER_CRITICAL_ISR() portENTER_CRITICAL_ISR(&asyncScannerMux)
+#define ASYNC_SCANNER_EXIT_CRITICAL_ISR() portEXIT_CRITICAL_ISR(&asyncScannerMux)
+#else
+#define ASYNC_SCANNER_ENTER_CRITICAL() noInterrupts()
+#define ASYNC_SCANNER_EXIT_CRITICAL() interrupts()
+#define ASYNC_SCANNER_ENTER_CRITICAL_ISR()
+#define ASYNC_SCANNER_EXIT_CRITICAL_ISR()
+#endif
+
+    namespace ResumableSlicer
     {
-      if (Radio::current_State != Radio::States::Radio_RX)
-        return false;
+      static States state = States::SeekingPreamble;
+      static bool lastLevel = false;
+      static unsigned long lastEdge_us = 0;
+      static unsigned int rawCodeLength = 0;
+      static unsigned long pendingPreamble_us = 0; // preamble of a frame which started on the edge ending the previous one
 
-      if (!params::async_mode_enabled)
+      void reset()
       {
+        state = States::SeekingPreamble;
+        rawCodeLength = 0;
+        pendingPreamble_us = 0;
+      }
 
-        unsigned long Timer = millis() + params::scan_high_time;
+      States getState()
+      {
+        return state;
+      }
 
-        while (Timer > millis()) // || RepeatingTimer > millis())
+      static bool endOfSignal(bool timedOut)
+      {
+        state = States::SeekingPreamble;
+
+        if (timedOut) // pulse which timed out is most likely the trailing gap, it's kept with the timeout as length
+          RawSignal.Pulses[rawCodeLength++] = params::signal_end_timeout / params::sample_rate;
+
+        if (rawCodeLength < params::min_raw_pulses)
         {
-          bool success = false;
+          RawSignal.Number = 0;
+          return false;
+        }
 
-          if(runtime::appliedSlicer == Slicer_enum::Legacy)
-            success = FetchSignal_sync();
-          else if (runtime::appliedSlicer == Slicer_enum::RSSI_Advanced)
-            success = FetchSignal_sync_rssi();
-          else {
-            sprintf_P(printBuf, PSTR("Invalid slicer selected (%i)"), (int) runtime::appliedSlicer);
-          }
+        RawSignal.Number = rawCodeLength - 1;
+        RawSignal.Multiply = params::sample_rate;
+        RawSignal.Time = millis(); // Time the RF packet was received (to keep track of retransmits
+        RawSignal.endReason = timedOut ? EndReasons::SignalEndTimeout : EndReasons::TooLong;
+        return true;
+      }
+
+      static void startFrame(unsigned long preamble_us)
+      {
+        rawCodeLength = 0;
+        RawSignal.Pulses[rawCodeLength++] = preamble_us / params::sample_rate;
+        state = States::Receiving;
+      }
+
+      bool feed(bool level, unsigned long now_us)
+      {
+        unsigned long pulseLength_us = now_us - lastEdge_us;
+
+        if (pendingPreamble_us != 0)
+        { // the previous frame has been handed over, RawSignal is free again
+          RawSignal.Pulses[0] = pendingPreamble_us / params::sample_rate;
+          pendingPreamble_us = 0;
+        }
+
+        if (level == lastLevel)
+        { // no edge, only a running signal can time out
+          if (state == States::Receiving && pulseLength_us > params::signal_end_timeout)
+            return endOfSignal(true);
+          return false;
+        }
+
+        lastLevel = level;
+        lastEdge_us = now_us;
+
+        if (state == States::SeekingPreamble)
+        {
+          // a long enough LOW period followed by a rising edge is what FetchSignal_sync() calls a preamble
+          if (level == HIGH && pulseLength_us >= params::min_preamble)
+            startFrame(pulseLength_us);
+          return false;
+        }
 
-          if (success)
-          { // RF: *** data start ***
-            counters::receivedSignalsCount++;
-            if (PluginRXCall(0, 0))
-            { // Check all plugins to see which plugin can handle the received signal.
-              counters::successfullyDecodedSignalsCount++;
-              RepeatingTimer = millis() + params::signal_repeat_time;
-              //auto responseLength = strlen(pbuffer);
-              //if(responseLength>1)
-              //  sprintf(&pbuffer[responseLength-2], "RSSI=%i;\r\n", (int)RawSignal.rssi);
-              return true;
+        if (pulseLength_us > params::signal_end_timeout)
+        {
+          // poll() gave up in the middle of the frame and was called again too late to see the timeout:
+          // the frame ended with this gap, which must not be stored as a pulse, and this edge may start the next one
+          bool received = endOfSignal(true);
+          if (level == HIGH && pulseLength_us >= params::min_preamble)
+          {
+            if (received)
+            { // Pulses[0] of the frame being returned is still needed, the new preamble is stored on next edge
+              pendingPreamble_us = pulseLength_us;
+              rawCodeLength = 1;
+              state = States::Receiving;
             }
+            else
+              startFrame(pulseLength_us);
           }
-        } // while
+          return received;
+        }
+
+        // ***   Too short Pulse Check   ***
+        if (pulseLength_us < params::min_pulse_len)
+        {
+          reset();
+          return false;
+        }
+
+        if (rawCodeLength % 2 == 0)
+        {
+          auto newRssi = Radio::getCurrentRssi();
+          if (RawSignal.rssi + 10 < newRssi)
+          {
+            rawCodeLength = 0;
+            RawSignal.rssi = newRssi;
+          }
+        }
+
+        RawSignal.Pulses[rawCodeLength++] = pulseLength_us / params::sample_rate;
+
+        if (rawCodeLength >= RAW_BUFFER_SIZE)
+          return endOfSignal(false);
+
         return false;
       }
 
-      // here we are in ASYNC mode
+      bool poll()
+      {
+        unsigned long start_us = micros();
+
+        for (;;)
+        {
+          unsigned long now_us = micros();
+
+          if (feed(digitalRead(Radio::pins::RX_DATA) == HIGH, now_us))
+            return true;
+
+          if (state == States::SeekingPreamble)
+          {
+            if (now_us - start_us >= params::poll_budget)
+              return false;
+          }
+          else if (now_us - start_us >= params::scan_high_time * 1000UL)
+            return false; // we will resume at next call but this pulse will probably be seen too long
+        }
+      }
+    }
+
+    namespace RepeatCache
+    {
+      struct Entry
+      {
+        byte pluginId;              // 0 means free slot
+        unsigned long deviceId;
+        unsigned long payloadHash;
+        unsigned long lastSeen_ms;
+        unsigned long ttl_ms;
+      };
+
+      Entry entries[REPEAT_CACHE_SIZE];
+      // packet added by the plugin being called and the entry it replaced, put back if the plugin rejects the frame
+      int8_t addedSlot = -1;
+      Entry replaced;
+
+      void reset()
+      {
+        for (byte i = 0; i < REPEAT_CACHE_SIZE; i++)
+          entries[i].pluginId = 0;
+        addedSlot = -1;
+      }
+
+      void pluginDone(bool decoded)
+      {
+        if (!decoded && addedSlot >= 0)
+          entries[addedSlot] = replaced;
+        addedSlot = -1;
+      }
+
+      bool isRepeat(unsigned long deviceId, unsigned long payloadHash, unsigned long extraTime_ms)
+      {
+        byte pluginId = Plugin_id[SignalHash];
+        unsigned long now = millis();
+        byte slot = 0;
+        unsigned long slotAge = 0;
+        bool slotFree = false;
+
+        for (byte i = 0; i < REPEAT_CACHE_SIZE; i++)
+        {
+          Entry &entry = entries[i];
+          unsigned long age = now - entry.lastSeen_ms;
+
+          if (entry.pluginId == 0 || age >= entry.ttl_ms)
+          { // free or expired, best place for a new packet
+            entry.pluginId = 0;
+            if (!slotFree)
+            {
+              slot = i;
+              slotFree = true;
+            }
+            continue;
+          }
 
-      if (!RawSignal.readyForDecoder)
+          if (entry.pluginId == pluginId && entry.deviceId == deviceId && entry.payloadHash == payloadHash)
+          {
+            entry.lastSeen_ms = now; // retransmits keep the packet in the cache until the burst is over
+            counters::repeatsSuppressedCount++;
+            return true;
+          }
+
+          if (!slotFree && age >= slotAge)
+          { // otherwise replace the oldest one
+            slot = i;
+            slotAge = age;
+          }
+        }
+
+        Entry &entry = entries[slot];
+        replaced = entry;
+        addedSlot = slot;
+        entry.pluginId = pluginId;
+        entry.deviceId = deviceId;
+        entry.payloadHash = payloadHash;
+        entry.lastSeen_ms = now;
+        entry.ttl_ms = params::signal_repeat_time + extraTime_ms;
+        return false;
+      }
+    }
+
+    // Takes the next frame from the receiver into RawSignal: one attempt of the sync slicers, or the async queue
+    static bool fetchFrame()
+    {
+      if (params::async_mode_enabled)
       {
-        if (AsyncSignalScanner::nextPulseTimeoutTime_us > 0 && AsyncSignalScanner::nextPulseTimeoutTime_us < micros())
-        { // may be current pulse has now timedout so we have a signal?
+        if (AsyncSignalScanner::queue::isEmpty())
+        {
+          if (AsyncSignalScanner::nextPulseTimeoutTime_us > 0 && AsyncSignalScanner::nextPulseTimeoutTime_us < micros())
+          { // may be current pulse has now timedout so we have a signal?
 
-          AsyncSignalScanner::onPulseTimerTimeout(); // refresh signal properties
+            ASYNC_SCANNER_ENTER_CRITICAL(); // onPulseTimerTimeout() is the producer side of the queue, it must not race with the ISR
+            if (AsyncSignalScanner::nextPulseTimeoutTime_us > 0 && AsyncSignalScanner::nextPulseTimeoutTime_us < micros())
+              AsyncSignalScanner::onPulseTimerTimeout(); // refresh signal properties
+            ASYNC_SCANNER_EXIT_CRITICAL();
+          }
 
-          if (!RawSignal.readyForDecoder) // still dont have a valid signal?
+          if (AsyncSignalScanner::queue::isEmpty()) // still dont have a valid signal?
             return false;
         }
-        else
-          return false;
+
+        AsyncSignalScanner::queue::pop(RawSignal);
+        return true;
       }
 
+      if (runtime::appliedSlicer == Slicer_enum::Legacy_Resumable)
+        return ResumableSlicer::poll();
+      if (runtime::appliedSlicer == Slicer_enum::Legacy)
+        return FetchSignal_sync();
+      if (runtime::appliedSlicer == Slicer_enum::RSSI_Advanced)
+        return FetchSignal_sync_rssi();
+
+      sprintf_P(printBuf, PSTR("Invalid slicer selected (%i)"), (int) runtime::appliedSlicer);
+      return false;
+    }
+
+    // Sync slicers give up after params::seek_timeout, ScanEvent() tries again until params::scan_high_time
+    static bool isSyncSlicer()
+    {
+      return !params::async_mode_enabled && runtime::appliedSlicer != Slicer_enum::Legacy_Resumable;
+    }
+
+    static bool decodeFrame()
+    {
       counters::receivedSignalsCount++; // we have a signal, let's increment counters
+      Capture::record(RawSignal);
 
+      RawSignal.readyForDecoder = true;
       byte signalWasDecoded = PluginRXCall(0, 0); // Check all plugins to see which plugin can handle the received signal.
       if (signalWasDecoded)
-      { // Check all plugins to see which plugin can handle the received signal.
         counters::successfullyDecodedSignalsCount++;
-        RepeatingTimer = millis() + params::signal_repeat_time;
-      }
-      AsyncSignalScanner::startScanning();
+      RawSignal.readyForDecoder = false;
       return (signalWasDecoded != 0);
     }
 
+    boolean ScanEvent()
+    {
+      if (Radio::current_State != Radio::States::Radio_RX)
+        return false;
+
+      if (!isSyncSlicer())
+        return fetchFrame() && decodeFrame();
+
+      unsigned long Timer = millis() + params::scan_high_time;
+
+      while (Timer > millis())
+      {
+        if (fetchFrame() && decodeFrame()) // RF: *** data start ***
+          return true;
+      }
+      return false;
+    }
+
     namespace AsyncSignalScanner
     {
       unsigned long int lastChangedState_us = 0;
-      unsigned long int nextPulseTimeoutTime_us = 0;
+      volatile unsigned long int nextPulseTimeoutTime_us = 0;
       bool scanningStopped = true;
 
+      namespace queue
+      {
+        CapturedFrame frames[ASYNC_QUEUE_SIZE];
+        volatile byte head = 0;
+        volatile byte tail = 0;
+
+        void reset()
+        {
+          head = 0;
+          tail = 0;
+          frames[0].Number = 0;
+          frames[0].Time = 0;
+        }
+
+        bool IRAM_ATTR storePulse(CapturedFrame &frame, uint16_t pulse)
+        {
+          #ifdef RFLINK_SIGNAL_COMPACT_QUEUE_ENABLED
+          if (frame.Number <= 1)
+            frame.Size = 0; // first pulse of a new frame
+
+          unsigned int code = (pulse + ASYNC_COMPACT_PULSE_QUANTUM / 2) / ASYNC_COMPACT_PULSE_QUANTUM;
+          if (code != ASYNC_COMPACT_PULSE_ESCAPE && code <= 0xFF)
+          {
+            if (frame.Size >= ASYNC_COMPACT_FRAME_SIZE)
+              return false;
+            frame.Pulses[frame.Size++] = code;
+          }
+          else
+          {
+            if (frame.Size + 3 > ASYNC_COMPACT_FRAME_SIZE)
+              return false;
+            frame.Pulses[frame.Size++] = ASYNC_COMPACT_PULSE_ESCAPE;
+            frame.Pulses[frame.Size++] = pulse & 0xFF;
+            frame.Pulses[frame.Size++] = pulse >> 8;
+          }
+          #else
+          frame.Pulses[frame.Number] = pulse;
+          #endif
+          return true;
+        }
+
+        bool pop(RawSignalStruct &signal)
+        {
+          if (isEmpty())
+            return false;
+
+          __sync_synchronize(); // make sure we read pulses written by the ISR before it published 'head'
+
+          const CapturedFrame &frame = frames[tail];
+          signal.Number = frame.Number;
+          signal.Time = frame.Time;
+          signal.Multiply = frame.Multiply;
+          #ifdef RFLINK_SIGNAL_COMPACT_QUEUE_ENABLED
+          const uint8_t *cursor = frame.Pulses;
+          for (int i = 1; i <= frame.Number; i++)
+          {
+            if (*cursor != ASYNC_COMPACT_PULSE_ESCAPE)
+            {
+              signal.Pulses[i] = *cursor++ * ASYNC_COMPACT_PULSE_QUANTUM;
+            }
+            else
+            {
+              signal.Pulses[i] = cursor[1] | (cursor[2] << 8);
+              cursor += 3;
+            }
+          }
+          #else
+          memcpy(&signal.Pulses[1], &frame.Pulses[1], sizeof(uint16_t) * frame.Number);
+          #endif
+
+          __sync_synchronize();
+          tail = (tail + 1) % ASYNC_QUEUE_SIZE; // slot can now be reused by the ISR
+          return true;
+        }
+      }
+
       void enableAsyncReceiver()
       {
         params::async_mode_enabled = true;
@@ -680,10 +1018,7 @@ namespace RFLink
         if (params::async_mode_enabled)
         {
           scanningStopped = false;
-          RawSignal.readyForDecoder = false;
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
-          RawSignal.Multiply = params::sample_rate;
+          queue::reset();
           lastChangedState_us = 0;
           nextPulseTimeoutTime_us = 0;
           attachInterrupt(digitalPinToInterrupt(Radio::pins::RX_DATA), RX_pin_changed_state, CHANGE);
@@ -702,13 +1037,10 @@ namespace RFLink
         }
       }
 
-      void IRAM_ATTR RX_pin_changed_state()
+      static void IRAM_ATTR handlePinChange(unsigned long changeTime_us)
       {
         static unsigned long lastChangedState_us = 0;
-        unsigned long changeTime_us = micros();
-
-        if (RawSignal.readyForDecoder) // it means previous packet has not been decoded yet, let's forget about it
-          return;
+        CapturedFrame &frame = queue::frames[queue::head]; // slot being captured, decoder never reads it
 
         unsigned long pulseLength_us = changeTime_us - lastChangedState_us;
         lastChangedState_us = changeTime_us;
@@ -716,19 +1048,19 @@ namespace RFLink
         if (pulseLength_us < params::min_pulse_len)
         {                              // this is too short, noise?
           nextPulseTimeoutTime_us = 0; // stop watching for a timeout
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
+          frame.Number = 0;
+          frame.Time = 0;
         }
 
         int pinState = digitalRead(Radio::pins::RX_DATA);
 
-        if (RawSignal.Time == 0)
+        if (frame.Time == 0)
         {                    // this is potentially the beginning of a new signal
           if (pinState != 1) // if we get 0 here it means that we are in the middle of a signal, let's forget about it
             return;
 
-          RawSignal.Time = millis(); // record when this signal started
-          RawSignal.Multiply = Signal::params::sample_rate;
+          frame.Time = millis(); // record when this signal started
+          frame.Multiply = Signal::params::sample_rate;
           nextPulseTimeoutTime_us = changeTime_us + SIGNAL_END_TIMEOUT_US;
 
           return;
@@ -740,75 +1072,249 @@ namespace RFLink
           return;
         }
 
-        RawSignal.Number++;
+        frame.Number++;
 
-        if (RawSignal.Number >= RAW_BUFFER_SIZE)
+        if (frame.Number >= RAW_BUFFER_SIZE)
         {                              // this signal has too many pulses and will be discarded
           nextPulseTimeoutTime_us = 0; // stop watching for a timeout
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
+          frame.Number = 0;
+          frame.Time = 0;
           //Serial.println("this signal has too many pulses and will be discarded");
           return;
         }
 
-        if (RawSignal.Number == 0 && pulseLength_us < SIGNAL_MIN_PREAMBLE_US)
+        if (frame.Number == 0 && pulseLength_us < SIGNAL_MIN_PREAMBLE_US)
         {                              // too short preamble, let's drop it
           nextPulseTimeoutTime_us = 0; // stop watching for a timeout
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
+          frame.Number = 0;
+          frame.Time = 0;
           //Serial.print("too short preamble, let's drop it:");Serial.println(pulseLength_us);
           return;
         }
 
-        //Serial.print("found pulse #");Serial.println(RawSignal.Number);
-        RawSignal.Pulses[RawSignal.Number] = pulseLength_us / Signal::params::sample_rate;
+        //Serial.print("found pulse #");Serial.println(frame.Number);
+        if (!queue::storePulse(frame, pulseLength_us / Signal::params::sample_rate))
+        {                              // no room left in a compact frame, same as too many pulses
+          nextPulseTimeoutTime_us = 0;
+          frame.Number = 0;
+          frame.Time = 0;
+          return;
+        }
         nextPulseTimeoutTime_us = changeTime_us + SIGNAL_END_TIMEOUT_US;
       }
 
-      void onPulseTimerTimeout()
+      void IRAM_ATTR RX_pin_changed_state()
       {
-        if (RawSignal.readyForDecoder)
-        { // it means previous packet has not been decoded yet, let's forget about it
-          //Serial.println("previous signal not decoded yet, discarding this one");
-          nextPulseTimeoutTime_us = 0;
-          return;
-        }
+        unsigned long changeTime_us = micros();
+        ASYNC_SCANNER_ENTER_CRITICAL_ISR();
+        handlePinChange(changeTime_us);
+        ASYNC_SCANNER_EXIT_CRITICAL_ISR();
+      }
+
+      void IRAM_ATTR onPulseTimerTimeout()
+      {
+        CapturedFrame &frame = queue::frames[queue::head];
 
         /*if (digitalRead(RX_DATA) == HIGH) {   // We have a corrupted packet here
         Serial.println("corrupted signal ends with HIGH");
-        RawSignal.Number = 0;
-        RawSignal.Time = 0;
+        frame.Number = 0;
+        frame.Time = 0;
         nextPulseTimeoutTime_us = 0;
         return;
       }*/
 
-        if (RawSignal.Number == 0)
+        if (frame.Number == 0)
         { // timeout on preamble!
           //Serial.println("timeout on preamble");
           nextPulseTimeoutTime_us = 0;
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
+          frame.Number = 0;
+          frame.Time = 0;
           return;
         }
 
-        if (RawSignal.Number < MIN_RAW_PULSES)
+        if (frame.Number < MIN_RAW_PULSES)
         { // not enough pulses, we ignore it
           nextPulseTimeoutTime_us = 0;
-          RawSignal.Number = 0;
-          RawSignal.Time = 0;
+          frame.Number = 0;
+          frame.Time = 0;
           return;
         }
 
         // finally we have one!
-        stopScanning();
         nextPulseTimeoutTime_us = 0;
-        RawSignal.Number++;
-        RawSignal.Pulses[RawSignal.Number] = SIGNAL_END_TIMEOUT_US / Signal::params::sample_rate;
-        //Serial.print("found one packet, marking now for decoding. Pulses = ");Serial.println(RawSignal.Number);
-        RawSignal.readyForDecoder = true;
+        frame.Number++;
+        if (!queue::storePulse(frame, SIGNAL_END_TIMEOUT_US / Signal::params::sample_rate))
+        {
+          frame.Number = 0;
+          frame.Time = 0;
+          return;
+        }
+
+        byte nextHead = (queue::head + 1) % ASYNC_QUEUE_SIZE;
+        if (nextHead == queue::tail)
+        { // decoder is late and all slots are taken, this one is lost
+          counters::asyncQueueDroppedSignalsCount++;
+          frame.Number = 0;
+          frame.Time = 0;
+          return;
+        }
+
+        queue::frames[nextHead].Number = 0;
+        queue::frames[nextHead].Time = 0;
+        __sync_synchronize(); // pulses must be visible before the frame is published
+        queue::head = nextHead;
+        //Serial.print("found one packet, queued for decoding. Pulses = ");Serial.println(frame.Number);
       }
     };
 
+#ifdef RFLINK_SIGNAL_TASK_ENABLED
+    namespace ScanTask
+    {
+      SemaphoreHandle_t mutex = nullptr;
+      static TaskHandle_t task = nullptr;
+      static volatile bool capturing = false;        // the task is filling RawSignal, without the lock
+      static volatile byte suspendDepth = 0;         // suspend() calls not resumed yet
+      static volatile unsigned long suspendCount = 0; // frames captured across a suspend() are not decoded
+
+      void lock()
+      {
+        if (mutex != nullptr)
+          xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+      }
+
+      void unlock()
+      {
+        if (mutex != nullptr)
+          xSemaphoreGiveRecursive(mutex);
+      }
+
+      void suspend()
+      {
+        if (mutex == nullptr)
+          return;
+
+        lock();
+        suspendDepth++;
+        suspendCount++;
+        while (capturing) // at most params::scan_high_time, the slicers don't wait longer
+          vTaskDelay(1);
+      }
+
+      void resume()
+      {
+        if (mutex == nullptr)
+          return;
+
+        suspendDepth--;
+        unlock();
+      }
+
+      // single producer (the task) / single consumer (the main loop) ring
+      static char printed[SIGNAL_TASK_PRINT_BUFFER_SIZE];
+      static volatile unsigned int printedHead = 0; // written by the task only
+      static volatile unsigned int printedTail = 0; // written by the main loop only
+
+      bool isTask()
+      {
+        return task != nullptr && xTaskGetCurrentTaskHandle() == task;
+      }
+
+      bool print(const char *text)
+      {
+        if (!isTask())
+          return false;
+
+        size_t length = strlen(text);
+        unsigned int head = printedHead;
+        size_t room = (printedTail + SIGNAL_TASK_PRINT_BUFFER_SIZE - head - 1) % SIGNAL_TASK_PRINT_BUFFER_SIZE;
+        if (length > room)
+        { // a partial line would be worse than a missing one
+          counters::scanTaskPrintDroppedCount += length;
+          return true;
+        }
+
+        for (size_t i = 0; i < length; i++)
+        {
+          printed[head] = text[i];
+          head = (head + 1) % SIGNAL_TASK_PRINT_BUFFER_SIZE;
+        }
+        printedHead = head; // last, the text is complete
+        return true;
+      }
+
+      size_t takePrinted(char *buffer, size_t size)
+      {
+        unsigned int tail = printedTail;
+        size_t count = 0;
+        while (count < size && tail != printedHead)
+        {
+          buffer[count++] = printed[tail];
+          tail = (tail + 1) % SIGNAL_TASK_PRINT_BUFFER_SIZE;
+        }
+        printedTail = tail;
+        return count;
+      }
+
+      static void taskLoop(void *)
+      {
+        unsigned long window_ms = millis();
+
+        for (;;)
+        {
+          if (suspendDepth != 0)
+          { // waits for resume()
+            unsigned long waitStart_ms = millis();
+            lock();
+            unlock();
+            counters::scanTaskStalledTime_ms += millis() - waitStart_ms;
+          }
+
+          unsigned long generation = suspendCount;
+          capturing = true;
+          bool received = suspendDepth == 0 && Radio::current_State == Radio::States::Radio_RX && fetchFrame();
+          capturing = false;
+
+          if (received)
+          {
+            unsigned long waitStart_ms = millis();
+            lock();
+            counters::scanTaskStalledTime_ms += millis() - waitStart_ms;
+
+            if (generation == suspendCount) // otherwise RawSignal was used by someone else meanwhile
+              decodeFrame();                // decoded messages go to outputQueue, the main loop sends them
+            unlock();
+          }
+
+          // sync slicers keep sampling for params::scan_high_time as ScanEvent() does
+          if (!isSyncSlicer() || millis() - window_ms >= params::scan_high_time)
+          {
+            vTaskDelay(1); // let IDLE task run, or the watchdog will bite
+            window_ms = millis();
+          }
+        }
+      }
+
+      void start()
+      {
+        mutex = xSemaphoreCreateRecursiveMutex();
+
+        if (mutex == nullptr)
+        {
+          Serial.println(F("Failed to allocate Signal task resources"));
+          return;
+        }
+
+        if (xTaskCreatePinnedToCore(taskLoop, "RFLinkScan", SIGNAL_TASK_STACK_SIZE, nullptr, SIGNAL_TASK_PRIORITY, &task, SIGNAL_TASK_CORE) != pdPASS)
+        {
+          Serial.println(F("Failed to start Signal task"));
+          return;
+        }
+
+        Serial.printf_P(PSTR("Signal task started on core %i\r\n"), SIGNAL_TASK_CORE);
+      }
+    }
+#endif // RFLINK_SIGNAL_TASK_ENABLED
+
     /*********************************************************************************************\
    Send bitstream to RF - Plugin 004 (Newkaku) special version
 \*********************************************************************************************/
@@ -1110,6 +1616,17 @@ namespace RFLink
       auto &&signal = output.createNestedObject("signal");
       signal[F("received_signal_count")] = counters::receivedSignalsCount;
       signal[F("successfully_decoded_count")] = counters::successfullyDecodedSignalsCount;
+      signal[F("async_queue_dropped_count")] = counters::asyncQueueDroppedSignalsCount;
+      signal[F("repeats_suppressed_count")] = counters::repeatsSuppressedCount;
+      signal[F("subframes_decoded_count")] = counters::subFramesDecodedCount;
+      signal[F("truncated_messages_count")] = display_TruncatedMessagesCount;
+      signal[F("output_queue_dropped_count")] = outputQueue.droppedCount;
+      signal[F("output_queue_skipped_count")] = outputQueue.skippedCount;
+      signal[F("output_queue_max_depth")] = outputQueue.maxDepth;
+      #ifdef RFLINK_SIGNAL_TASK_ENABLED
+      signal[F("scan_task_stalled_ms")] = counters::scanTaskStalledTime_ms;
+      signal[F("scan_task_print_dropped_count")] = counters::scanTaskPrintDroppedCount;
+      #endif
     }
 
     void displaySignal(RawSignalStruct &signal) {
@@ -1139,6 +1656,201 @@ namespace RFLink
       RFLink::sendRawPrint(F("\r\n"));
     }
 
+    #define FRAME_WORK_CLUSTERS 8  // clusters tracked while scanning, only the largest ones are kept
+    #define FRAME_GAP_RATIO 2       // a gap is longer than this many times the longest data pulse
+
+    // a pulse belongs to a cluster when within 37.5% of its centroid
+    static inline bool isInCluster(uint16_t pulse, uint16_t centroid)
+    {
+      return (unsigned long)abs((long)pulse - (long)centroid) * 8 <= (unsigned long)centroid * 3;
+    }
+
+    static byte findCluster(const FrameFeaturesStruct &features, uint16_t pulse)
+    {
+      for (byte c = 0; c < features.clustersCount; c++)
+      {
+        if (isInCluster(pulse, features.clusters[c]))
+          return c;
+      }
+      return 0xFF;
+    }
+
+    void computeFrameFeatures(const RawSignalStruct &signal, FrameFeaturesStruct &features)
+    {
+      uint16_t centroids[FRAME_WORK_CLUSTERS];
+      uint16_t sizes[FRAME_WORK_CLUSTERS];
+      unsigned long sums[FRAME_WORK_CLUSTERS];
+      byte workCount = 0;
+      unsigned long total = 0;
+
+      features.Number = signal.Number;
+      features.minPulse = 0xFFFF;
+      features.maxPulse = 0;
+      features.meanPulse = 0;
+      features.clustersCount = 0;
+      features.gapsCount = 0;
+      features.modulation = Modulation_Unknown;
+
+      if (signal.Number <= 0)
+      {
+        features.minPulse = 0;
+        return;
+      }
+
+      for (int i = 1; i <= signal.Number; i++)
+      {
+        uint16_t pulse = signal.Pulses[i];
+        total += pulse;
+        if (pulse < features.minPulse)
+          features.minPulse = pulse;
+        if (pulse > features.maxPulse)
+          features.maxPulse = pulse;
+
+        byte nearest = 0;
+        uint16_t nearestDistance = 0xFFFF;
+        for (byte c = 0; c < workCount; c++)
+        {
+          uint16_t distance = abs((long)pulse - (long)centroids[c]);
+          if (distance < nearestDistance)
+          {
+            nearest = c;
+            nearestDistance = distance;
+          }
+        }
+
+        if (workCount == 0 || (!isInCluster(pulse, centroids[nearest]) && workCount < FRAME_WORK_CLUSTERS))
+        {
+          nearest = workCount++;
+          sums[nearest] = 0;
+          sizes[nearest] = 0;
+        }
+        sums[nearest] += pulse;
+        sizes[nearest]++;
+        centroids[nearest] = sums[nearest] / sizes[nearest];
+      }
+      features.meanPulse = total / signal.Number;
+
+      // keep the largest clusters, then order them by duration
+      while (features.clustersCount < FRAME_MAX_CLUSTERS && features.clustersCount < workCount)
+      {
+        byte largest = 0;
+        for (byte c = 1; c < workCount; c++)
+        {
+          if (sizes[c] > sizes[largest])
+            largest = c;
+        }
+        byte position = features.clustersCount++;
+        while (position > 0 && features.clusters[position - 1] > centroids[largest])
+        {
+          features.clusters[position] = features.clusters[position - 1];
+          features.clusterSizes[position] = features.clusterSizes[position - 1];
+          position--;
+        }
+        features.clusters[position] = centroids[largest];
+        features.clusterSizes[position] = sizes[largest];
+        sizes[largest] = 0;
+      }
+
+      if (features.clustersCount < 2)
+        return;
+
+      // data pulses are the two most common widths
+      byte first = 0, second = 1;
+      for (byte c = 0; c < features.clustersCount; c++)
+      {
+        if (features.clusterSizes[c] > features.clusterSizes[first])
+          first = c;
+      }
+      second = (first == 0) ? 1 : 0;
+      for (byte c = 0; c < features.clustersCount; c++)
+      {
+        if (c != first && features.clusterSizes[c] > features.clusterSizes[second])
+          second = c;
+      }
+      const uint16_t shortPulse = features.clusters[min(first, second)];
+      const uint16_t longPulse = features.clusters[max(first, second)];
+
+      const unsigned long gapLength = (unsigned long)longPulse * FRAME_GAP_RATIO;
+      for (int i = 1; i <= signal.Number; i++)
+      {
+        if (signal.Pulses[i] > gapLength)
+        {
+          if (features.gapsCount < FRAME_MAX_GAPS)
+            features.gaps[features.gapsCount] = i;
+          features.gapsCount++;
+        }
+      }
+
+      // look at which widths marks and spaces use, gaps excluded
+      unsigned int pairs = 0, mixedPairs = 0;
+      unsigned int markSizes[FRAME_MAX_CLUSTERS] = {0}, spaceSizes[FRAME_MAX_CLUSTERS] = {0};
+      for (int i = 1; i < signal.Number; i += 2)
+      {
+        if (signal.Pulses[i] > gapLength || signal.Pulses[i + 1] > gapLength)
+          continue;
+        byte mark = findCluster(features, signal.Pulses[i]), space = findCluster(features, signal.Pulses[i + 1]);
+        if (mark == 0xFF || space == 0xFF)
+          continue;
+        pairs++;
+        markSizes[mark]++;
+        spaceSizes[space]++;
+        if (mark != space)
+          mixedPairs++;
+      }
+
+      if (pairs < 8)
+        return;
+
+      byte markWidths = 0, spaceWidths = 0; // widths used by at least 10% of the pairs
+      for (byte c = 0; c < features.clustersCount; c++)
+      {
+        if (markSizes[c] * 10 >= pairs)
+          markWidths++;
+        if (spaceSizes[c] * 10 >= pairs)
+          spaceWidths++;
+      }
+
+      if (markWidths == 1 && spaceWidths > 1)
+        features.modulation = Modulation_PPM;
+      else if ((spaceWidths == 1 && markWidths > 1) || mixedPairs * 10 >= pairs * 9)
+        features.modulation = Modulation_PWM;
+      else if ((unsigned long)longPulse * 10 >= (unsigned long)shortPulse * 16 && (unsigned long)longPulse * 10 <= (unsigned long)shortPulse * 24)
+        features.modulation = Modulation_Manchester;
+    }
+
+    void indexSubFrames(const RawSignalStruct &signal, const FrameFeaturesStruct &features, SubFramesStruct &subFrames)
+    {
+      subFrames.Number = signal.Number;
+      subFrames.count = 0;
+
+      const uint16_t gapLength = SUBFRAME_GAP_US / signal.Multiply;
+      int start = 1;
+      uint32_t signature = 2166136261UL; // FNV-1a
+
+      for (int i = 1; i <= signal.Number; i++)
+      {
+        // only spaces can end a packet, the next one must start with a mark
+        if (((i & 1) == 0 && signal.Pulses[i] >= gapLength) || i == signal.Number)
+        {
+          if (i - start + 1 >= SUBFRAME_MIN_PULSES)
+          {
+            if (subFrames.count >= SUBFRAME_MAX)
+              break;
+            subFrames.ends[subFrames.count] = i;
+            subFrames.signatures[subFrames.count] = signature;
+            subFrames.count++;
+            start = i + 1;
+            signature = 2166136261UL;
+          }
+          continue; // the gap itself is not part of the signature
+        }
+        signature = (signature ^ findCluster(features, signal.Pulses[i])) * 16777619UL;
+      }
+
+      if (subFrames.count < 2) // a single packet, nothing to split
+        subFrames.count = 0;
+    }
+
     const char * const EndReasonsStrings[] PROGMEM = {
       "Unknown",
       "ReachedLongPulseTimeOut",
@@ -1156,7 +1868,8 @@ namespace RFLink
 
     const char * const SlicerNamesStrings[] PROGMEM = {
             "Legacy",
-            "RSSI_advanced"
+            "RSSI_advanced",
+            "Legacy_resumable"
     };
     static_assert(sizeof(SlicerNamesStrings)/sizeof(char *) == Slicer_enum::SLICERS_EOF, "SlicerNamesStrings has missing/extra names, please compare with Slicer_enum enum declarations");
 
@@ -1185,6 +1898,8 @@ namespace RFLink
         runtime::appliedSlicer = newSlicer;
       }
 
+      ResumableSlicer::reset();
+
       sprintf_P(printBuf, PSTR("Applied slicer '%s'"), slicerIdToString(runtime::appliedSlicer));
       sendRawPrint(printBuf, true);
 
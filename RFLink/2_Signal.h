@@ -11,11 +11,13 @@
 #include <Arduino.h>
 #include "11_Config.h"
 
+#ifndef RAW_BUFFER_SIZE
 #ifdef ESP32
 #define RAW_BUFFER_SIZE 1200        // 292        // Maximum number of pulses that is received in one go.
 #else
 #define RAW_BUFFER_SIZE 292        // 292        // Maximum number of pulses that is received in one go.
 #endif
+#endif
 #define MIN_RAW_PULSES 24          // 24         // Minimal number of bits that need to have been received before we spend CPU time on decoding the signal.
 #define SIGNAL_SEEK_TIMEOUT_MS 25  // 25         // After this time in mSec, RF signal will be considered absent.
 #define SIGNAL_MIN_PREAMBLE_US 100 // 400        // After this time in uSec, a RF signal will be considered to have started.
@@ -23,18 +25,59 @@
 #define SIGNAL_END_TIMEOUT_US 5000 // 5000       // After this time in uSec, the RF signal will be considered to have stopped.
 #define SIGNAL_REPEAT_TIME_MS 250  // 500        // Time in mSec. in which the same RF signal should not be accepted again. Filters out retransmits.
 #define SCAN_HIGH_TIME_MS 50       // 50         // time interval in ms. fast processing for background tasks
+#define SIGNAL_POLL_BUDGET_US 1000 // 1000       // Legacy_resumable slicer: time in uSec. spent looking for a signal before giving back the CPU
+#define REPEAT_CACHE_SIZE 16       // 16         // Number of recently decoded packets remembered to filter out retransmits.
+
+#define FRAME_MAX_CLUSTERS 4         // Pulse width clusters kept in FrameFeatures
+#define FRAME_MAX_GAPS 8             // Gap positions kept in FrameFeatures
+#define SUBFRAME_GAP_US 2500         // A space at least this long ends a packet within a burst
+#define SUBFRAME_MIN_PULSES 16       // Shorter packets are not split from the next one
+#define SUBFRAME_MAX 16              // Packets indexed for each received frame
 
 #define DEFAULT_RAWSIGNAL_SAMPLE_RATE 1    // for compatibility with Arduinos only unless you want to scan pulses > 65000us
 
+#ifdef RFLINK_SIGNAL_COMPACT_QUEUE_ENABLED // async receiver stores pulses on 8 bits, more frames fit in the same RAM
+#ifndef ASYNC_COMPACT_PULSE_QUANTUM
+#define ASYNC_COMPACT_PULSE_QUANTUM 4       // Resolution of stored pulses, in RawSignal.Pulses units (microseconds unless sample_rate is changed)
+#endif
+#define ASYNC_COMPACT_PULSE_ESCAPE 0        // Followed by the exact 16 bits value, for pulses longer than 255 * ASYNC_COMPACT_PULSE_QUANTUM
+#define ASYNC_COMPACT_FRAME_SIZE (RAW_BUFFER_SIZE + 64) // Bytes per frame: a full length frame can still hold 32 long pulses
+#ifndef ASYNC_QUEUE_SIZE
+#ifdef ESP32
+#define ASYNC_QUEUE_SIZE 7
+#else
+#define ASYNC_QUEUE_SIZE 5
+#endif
+#endif
+#endif
+
+#ifndef ASYNC_QUEUE_SIZE
+#ifdef ESP32
+#define ASYNC_QUEUE_SIZE 4         // Number of frame slots for the async receiver, one of them is always the one being captured.
+#else
+#define ASYNC_QUEUE_SIZE 3
+#endif
+#endif
+
+#ifdef RFLINK_SIGNAL_TASK_ENABLED // capture and decoding run in their own FreeRTOS task, away from network stuff
+#ifndef ESP32
+#error "RFLINK_SIGNAL_TASK_ENABLED is only supported on ESP32"
+#endif
+#ifndef SIGNAL_TASK_CORE
+#define SIGNAL_TASK_CORE 0             // Arduino loop() runs on core 1
+#endif
+#ifndef SIGNAL_TASK_PRIORITY
+#define SIGNAL_TASK_PRIORITY 1
+#endif
+#define SIGNAL_TASK_STACK_SIZE 8192
+#define SIGNAL_TASK_PRINT_BUFFER_SIZE 2048 // sendRawPrint() text of the Signal task, waiting for the main loop
+#endif
+
 #if defined(RFLINK_SIGNAL_DEBUG)
 #define RFLINK_SIGNAL_RSSI_DEBUG
 #endif
 
-extern unsigned long SignalCRC;   // holds the bitstream value for some plugins to identify RF repeats
-extern unsigned long SignalCRC_1; // holds the previous SignalCRC (for mixed burst protocols)
 extern byte SignalHash;           // holds the processed plugin number
-extern byte SignalHashPrevious;   // holds the last processed plugin number
-extern unsigned long RepeatingTimer;
 
 namespace RFLink {
   namespace Signal {
@@ -53,6 +96,7 @@ namespace RFLink {
       Default = -1,
       Legacy,
       RSSI_Advanced,
+      Legacy_Resumable,
       SLICERS_EOF,
     };
 
@@ -70,11 +114,61 @@ namespace RFLink {
       float Rssis[RAW_BUFFER_SIZE + 1];
       #endif
       uint16_t Pulses[RAW_BUFFER_SIZE + 1]; // Table with the measured pulses in microseconds divided by RawSignal.Multiply. (to keep compatibility with Arduino)
-      // First pulse is located in element 1. Element 0 is used for special purposes, like signalling the use of a specific plugin
+      // First pulse is located in element 1. Element 0 is unused, routing hints between plugins go through DispatchResult
     };
 
     extern RawSignalStruct RawSignal;
 
+    enum Modulation_enum {
+      Modulation_Unknown,
+      Modulation_PWM,        // pulse width: mark and space lengths carry the bit
+      Modulation_PPM,        // pulse position: constant marks, spaces carry the bit
+      Modulation_Manchester, // two widths, the long one being twice the short one
+      MODULATIONS_EOF,
+    };
+
+    /**
+     * Facts about the received frame, computed once before the plugins are called and again
+     * whenever a plugin changes RawSignal.Number. Durations are in RawSignal.Pulses units.
+     * */
+    struct FrameFeaturesStruct
+    {
+      int Number;                              // RawSignal.Number the features were computed for
+      uint16_t minPulse;
+      uint16_t maxPulse;
+      uint16_t meanPulse;
+      byte clustersCount;
+      uint16_t clusters[FRAME_MAX_CLUSTERS];     // centroids of the most common pulse widths, shortest first
+      uint16_t clusterSizes[FRAME_MAX_CLUSTERS]; // number of pulses in each cluster
+      uint16_t gapsCount;                      // pulses much longer than data pulses
+      int gaps[FRAME_MAX_GAPS];                // positions in Pulses[] of the first gaps
+      Modulation_enum modulation;
+    };
+
+    extern FrameFeaturesStruct FrameFeatures;
+
+    void computeFrameFeatures(const RawSignalStruct &signal, FrameFeaturesStruct &features);
+
+    /**
+     * Boundaries of the packets found in a received frame, when a transmitter repeats its packets with
+     * gaps too short to end the capture. Each sub-frame ends with its gap, so that it looks the same to
+     * the plugins as a packet which was received alone.
+     * */
+    struct SubFramesStruct
+    {
+      int Number;                         // RawSignal.Number the index was built for
+      byte count;                         // 0 when the frame holds a single packet
+      uint16_t ends[SUBFRAME_MAX];        // position in Pulses[] of the last pulse of each sub-frame
+      uint32_t signatures[SUBFRAME_MAX];  // pulse widths cluster of each pulse, hashed: repeats share it
+    };
+
+    extern SubFramesStruct SubFrames;
+
+    /**
+     * Splits 'signal' at the spaces longer than SUBFRAME_GAP_US, 'features' must have been computed for it.
+     * */
+    void indexSubFrames(const RawSignalStruct &signal, const FrameFeaturesStruct &features, SubFramesStruct &subFrames);
+
 
     namespace params {
       // All json variable names
@@ -87,6 +181,7 @@ namespace RFLink {
       extern unsigned long int signal_end_timeout;  // microseconds
       extern unsigned long int signal_repeat_time;  // milliseconds
       extern unsigned long int scan_high_time;      // milliseconds
+      extern unsigned long int poll_budget;         // microseconds
     }
 
     namespace runtime {
@@ -97,7 +192,13 @@ namespace RFLink {
     namespace counters {
       extern unsigned long int receivedSignalsCount;
       extern unsigned long int successfullyDecodedSignalsCount;
-
+      extern unsigned long int asyncQueueDroppedSignalsCount;
+      extern unsigned long int repeatsSuppressedCount;
+      extern unsigned long int subFramesDecodedCount;
+      #ifdef RFLINK_SIGNAL_TASK_ENABLED
+      extern unsigned long int scanTaskStalledTime_ms; // Signal task kept away from the receiver by the other tasks
+      extern unsigned long int scanTaskPrintDroppedCount; // characters printed by the Signal task which did not fit
+      #endif
     }
 
     extern Config::ConfigItem configItems[];
@@ -111,6 +212,12 @@ namespace RFLink {
     void executeCliCommand(char *cmd);
 
     bool ScanEvent();
+    /**
+     * Sync slicers used by ScanEvent(), they busy loop on the receiver until a signal is in RawSignal
+     * or params::seek_timeout has elapsed
+     * */
+    boolean FetchSignal_sync();
+    boolean FetchSignal_sync_rssi();
     void getStatusJsonString(JsonObject &output);
 
     void displaySignal(RawSignalStruct &signal);
@@ -123,11 +230,132 @@ namespace RFLink {
 
     bool updateSlicer(Slicer_enum newSlicer);
 
+    /**
+     * Remembers the last REPEAT_CACHE_SIZE packets decoded by the plugins, so retransmits of the
+     * same packet are reported only once even when several devices talk at the same time.
+     * Entries are keyed by (plugin id, device id, payload hash) and expire signal_repeat_time + extraTime_ms
+     * after the last time they were seen. Plugins call it with the decoded values right before display_Header().
+     * */
+    namespace RepeatCache {
+      /**
+       * @return true if this packet was already decoded recently by the current plugin and must be dropped
+       * */
+      bool isRepeat(unsigned long deviceId, unsigned long payloadHash, unsigned long extraTime_ms = 0);
+      /**
+       * Called by PluginRXCall() after each plugin: a packet added by a plugin which then rejects the
+       * frame is forgotten, so that the next copy of an undecodable frame is not swallowed as a repeat
+       * */
+      void pluginDone(bool decoded);
+      void reset();
+    }
+
+    /**
+     * Legacy slicer turned into a state machine which keeps its pulse state between calls.
+     * poll() gives the CPU back after params::poll_budget when no signal is in flight, so the main loop
+     * keeps running between frames. Once a signal has started it is sampled until its end (but never
+     * longer than params::scan_high_time) to keep edges accurate.
+     * */
+    namespace ResumableSlicer {
+      enum States {
+        SeekingPreamble,
+        Receiving,
+      };
+
+      void reset();
+      /**
+       * Process one sample of the receiver output, can be fed with any edge timeline.
+       * @return true when a complete signal is available in RawSignal
+       * */
+      bool feed(bool level, unsigned long now_us);
+      bool poll();
+      States getState();
+    }
+
+    /**
+     * When RFLINK_SIGNAL_TASK_ENABLED is defined, capture and decoding are run by a dedicated task pinned to
+     * SIGNAL_TASK_CORE and decoded events reach the main loop through outputQueue (see 4_Display.h).
+     * The task captures without any lock, it only holds lock() to hand a frame over to the decoders:
+     * RawSignal, plugins state, the event being recorded and the producer side of outputQueue.
+     * Other tasks use lock() for this shared state alone, and suspend() when they also need RawSignal or
+     * the radio (CLI commands, config changes): it waits for the capture in progress and keeps the task
+     * away until resume(). A frame captured meanwhile is dropped.
+     * The task never writes to Serial or Serial2Net clients itself: what it gives to sendRawPrint() is queued by
+     * print() and written by the main loop, which is the only one using these sinks.
+     * */
+    namespace ScanTask {
+      #ifdef RFLINK_SIGNAL_TASK_ENABLED
+      void start();
+      void lock();
+      void unlock();
+      void suspend();
+      void resume();
+      bool isTask(); // true when called by the Signal task
+      /**
+       * Queues text when called by the Signal task, text which does not fit is dropped
+       * @return false when called by another task, which must print the text itself
+       * */
+      bool print(const char *text);
+      /**
+       * Moves queued text to buffer, for the main loop
+       * @return number of characters written to buffer, which is not nul terminated
+       * */
+      size_t takePrinted(char *buffer, size_t size);
+      #else
+      inline void lock() {};
+      inline void unlock() {};
+      inline void suspend() {};
+      inline void resume() {};
+      inline bool isTask() { return false; };
+      inline bool print(const char *) { return false; };
+      inline size_t takePrinted(char *, size_t) { return 0; };
+      #endif
+    }
+
     namespace AsyncSignalScanner {
       extern unsigned long int lastChangedState_us;     // time last state change occured
-      extern unsigned long int nextPulseTimeoutTime_us; // when current pulse will timeout
+      extern volatile unsigned long int nextPulseTimeoutTime_us; // when current pulse will timeout
       extern bool scanningStopped;                      // 
 
+      struct CapturedFrame
+      {
+        int Number;
+        unsigned long Time;
+        byte Multiply;
+        #ifdef RFLINK_SIGNAL_COMPACT_QUEUE_ENABLED
+        uint16_t Size;                                // bytes used in Pulses
+        uint8_t Pulses[ASYNC_COMPACT_FRAME_SIZE];     // pulse / ASYNC_COMPACT_PULSE_QUANTUM, or escape + 16 bits value
+        #else
+        uint16_t Pulses[RAW_BUFFER_SIZE + 1];
+        #endif
+      };
+
+      /**
+       * Lock-free single producer / single consumer ring of captured frames.
+       * The ISR is the only writer of 'head' and captures into frames[head], ScanEvent() is the only
+       * writer of 'tail'. A frame is handed over to the decoder by moving 'head' forward.
+       * */
+      namespace queue {
+        extern CapturedFrame frames[ASYNC_QUEUE_SIZE];
+        extern volatile byte head;
+        extern volatile byte tail;
+
+        inline bool isEmpty() {
+          return head == tail;
+        };
+
+        void reset();
+        /**
+         * Stores pulse number frame.Number of the frame being captured
+         * @return false if the frame has no room left for it
+         * */
+        bool IRAM_ATTR storePulse(CapturedFrame &frame, uint16_t pulse);
+        /**
+         * Moves the oldest frame to 'signal', pulses are always given back in RawSignal.Pulses units
+         * whatever the storage of the queue.
+         * */
+        bool pop(RawSignalStruct &signal);
+      }
+
       void enableAsyncReceiver();
       void disableAsyncReceiver();
       /**
@@ -140,7 +368,7 @@ namespace RFLink {
       void stopScanning();
       void clearAllTimers();
       void IRAM_ATTR RX_pin_changed_state();
-      void onPulseTimerTimeout();
+      void IRAM_ATTR onPulseTimerTimeout();
 
       bool getSignalFromJson(RawSignalStruct &signal, const char *json_str);
 
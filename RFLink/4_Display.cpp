@@ -11,8 +11,582 @@
 #include "4_Display.h"
 
 byte PKSequenceNumber = 0;       // 1 byte packet counter
-char dbuffer[60];                // Buffer for message chunk data
 char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for complete message data
+unsigned long display_TruncatedMessagesCount = 0;
+
+#define DISPLAY_FOOTER_SIZE 4    // ";\r\n" and the terminating zero
+
+OutputBuilder pbufferBuilder(pbuffer, PRINT_BUFFER_SIZE, DISPLAY_FOOTER_SIZE);
+MessageQueue outputQueue;
+
+// ------------------- //
+// Output builder      //
+// ------------------- //
+
+OutputBuilder::OutputBuilder(char *buffer, size_t size, size_t reserved)
+    : buffer(buffer), size(size), reserved(reserved), cursor(0), truncated(false)
+{
+}
+
+size_t OutputBuilder::sync()
+{
+  // cursor is not at the end of the string anymore, someone else wrote to the buffer
+  if (cursor >= size || buffer[cursor] != 0 || (cursor > 0 && (buffer[0] == 0 || buffer[cursor - 1] == 0)))
+    cursor = strnlen(buffer, size - 1);
+  return cursor;
+}
+
+bool OutputBuilder::overflow()
+{
+  buffer[cursor] = 0; // drop the partial field
+  truncated = true;
+  return false;
+}
+
+void OutputBuilder::begin()
+{
+  cursor = strnlen(buffer, size - 1);
+  truncated = false;
+}
+
+size_t OutputBuilder::length()
+{
+  return sync();
+}
+
+bool OutputBuilder::append_P(PGM_P str, bool useReserved)
+{
+  size_t limit = useReserved ? size : size - reserved;
+  size_t len = strlen_P(str);
+
+  sync();
+  if (cursor + len + 1 > limit)
+    return overflow();
+
+  memcpy_P(buffer + cursor, str, len + 1);
+  cursor += len;
+  return true;
+}
+
+bool OutputBuilder::append(const char *str)
+{
+  size_t len = strlen(str);
+
+  sync();
+  if (cursor + len + 1 > size - reserved)
+    return overflow();
+
+  memcpy(buffer + cursor, str, len + 1);
+  cursor += len;
+  return true;
+}
+
+bool OutputBuilder::appendf_P(PGM_P format, ...)
+{
+  size_t available = size - reserved;
+
+  sync();
+  if (cursor + 1 >= available)
+    return overflow();
+
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf_P(buffer + cursor, available - cursor, format, args);
+  va_end(args);
+
+  if (len < 0 || cursor + len + 1 > available)
+    return overflow();
+
+  cursor += len;
+  return true;
+}
+
+// ------------------- //
+// Event record        //
+// ------------------- //
+
+enum ValueFormat
+{
+  Format_Hex2,
+  Format_Hex4,
+  Format_Dec2,
+  Format_Dec3,
+  Format_Dec4,
+  Format_TempD,   // signed tenths, +ddd.d
+  Format_Battery, // OK/LOW
+  Format_OnOff,
+  Format_Trend, // STABLE/UP/DOWN
+};
+
+enum ValueScale
+{
+  Scale_None,
+  Scale_Tenths,
+  Scale_SignedTenths, // high bit is the sign, as in TEMP
+  Scale_IntTenths,    // two's complement, as in TEMPD
+};
+
+struct ValueDescriptor
+{
+  char name[11];
+  byte format;
+  byte scale;
+};
+
+// Same order as EventValue
+static const ValueDescriptor valueDescriptors[EventValue_EOF] PROGMEM = {
+    {"CHN", Format_Hex4, Scale_None},
+    {"SET_LEVEL", Format_Dec2, Scale_None},
+    {"TEMP", Format_Hex4, Scale_SignedTenths},
+    {"TEMPD", Format_TempD, Scale_IntTenths},
+    {"HUM", Format_Dec2, Scale_None},
+    {"BARO", Format_Hex4, Scale_None},
+    {"HSTATUS", Format_Hex2, Scale_None},
+    {"BFORECAST", Format_Hex2, Scale_None},
+    {"UV", Format_Hex4, Scale_None},
+    {"LUX", Format_Hex4, Scale_None},
+    {"BAT", Format_Battery, Scale_None},
+    {"RAIN", Format_Hex4, Scale_Tenths},
+    {"RAINTOT", Format_Hex4, Scale_Tenths},
+    {"RAINRATE", Format_Hex4, Scale_Tenths},
+    {"WINSP", Format_Hex4, Scale_Tenths},
+    {"AWINSP", Format_Hex4, Scale_Tenths},
+    {"WINGS", Format_Hex4, Scale_None},
+    {"WINDIR", Format_Dec3, Scale_None},
+    {"WINCHL", Format_Hex4, Scale_SignedTenths},
+    {"WINTMP", Format_Hex4, Scale_SignedTenths},
+    {"CHIME", Format_Dec3, Scale_None},
+    {"TREND", Format_Trend, Scale_None},
+    {"SMOKEALERT", Format_OnOff, Scale_None},
+    {"PIR", Format_OnOff, Scale_None},
+    {"CO2", Format_Dec4, Scale_None},
+    {"SOUND", Format_Dec4, Scale_None},
+    {"KWATT", Format_Hex4, Scale_None},
+    {"WATT", Format_Hex4, Scale_None},
+    {"CURRENT", Format_Dec4, Scale_None},
+    {"DIST", Format_Dec4, Scale_None},
+    {"METER", Format_Dec4, Scale_None},
+    {"VOLT", Format_Dec4, Scale_None},
+    {"RGBW", Format_Hex4, Scale_None},
+};
+
+static EventRecord event; // filled by the display_* functions, from display_Header() to display_Footer()
+
+static inline void putLong(uint8_t *data, unsigned long value, byte size)
+{
+  for (byte i = 0; i < size; i++)
+    data[i] = value >> (8 * i);
+}
+
+static inline unsigned long getLong(const uint8_t *data, byte size)
+{
+  unsigned long value = 0;
+  for (byte i = 0; i < size; i++)
+    value |= (unsigned long)data[i] << (8 * i);
+  return value;
+}
+
+/**
+ * @return where the value of a new field goes, nullptr if the event has no room left for it
+ * */
+static uint8_t *reserveField(EventField type, size_t size)
+{
+  if (event.size + 1 + size > EVENT_RECORD_SIZE)
+  {
+    event.truncated = true;
+    return nullptr;
+  }
+
+  uint8_t *field = &event.data[event.size];
+  field[0] = type;
+  event.size += 1 + size;
+  return field + 1;
+}
+
+/**
+ * Records a field starting with a string, followed by extra bytes
+ * @return where the extra bytes go, nullptr if the event has no room left for the field
+ * */
+static uint8_t *recordString(EventField type, const char *str, size_t extra = 0)
+{
+  size_t len = strlen_P(str);
+  uint8_t *field = reserveField(type, len + 1 + extra);
+  if (field == nullptr)
+    return nullptr;
+
+  memcpy_P(field, str, len);
+  field[len] = 0;
+  return field + len + 1;
+}
+
+static void recordValue(EventValue value, unsigned long input)
+{
+  uint8_t *field = reserveField(Field_Value, 5);
+  if (field == nullptr)
+    return;
+
+  field[0] = value;
+  putLong(field + 1, input, 4);
+}
+
+struct DecodedField
+{
+  byte type;
+  const char *str;      // Name, NameEx, IDc, SwitchC, Custom
+  unsigned long number; // NameEx, ID, Switch, Cmd, Value and Custom
+  byte extra;           // ID digits, Cmd group, Value index, Debug length
+  const uint8_t *bytes; // Debug
+};
+
+/**
+ * @return first byte after the field at data
+ * */
+static const uint8_t *decodeField(const uint8_t *data, DecodedField &field)
+{
+  field.type = *data++;
+  field.str = (const char *)data;
+  field.bytes = data;
+
+  switch (field.type)
+  {
+  case Field_Name:
+  case Field_IDc:
+  case Field_SwitchC:
+    return data + strlen(field.str) + 1;
+  case Field_NameEx:
+    data += strlen(field.str) + 1;
+    field.number = getLong(data, 4);
+    return data + 4;
+  case Field_ID:
+    field.number = getLong(data, 4);
+    field.extra = data[4];
+    return data + 5;
+  case Field_Switch:
+    field.number = data[0];
+    return data + 1;
+  case Field_Cmd:
+    field.extra = data[0];
+    field.number = data[1];
+    return data + 2;
+  case Field_Value:
+    field.extra = data[0];
+    field.number = getLong(data + 1, 4);
+    return data + 5;
+  case Field_Debug:
+    field.extra = data[0];
+    field.bytes = data + 1;
+    return data + 1 + field.extra;
+  case Field_Custom:
+    data += strlen(field.str) + 1;
+    field.number = getLong(data, 4);
+    return data + 4;
+  case Field_Splash:
+  default:
+    return data;
+  }
+}
+
+// CMD=ON => Command (ON/OFF/ALLON/ALLOFF) Additional for Milight: DISCO+/DISCO-/MODE0 - MODE8
+static PGM_P commandName(byte on)
+{
+  switch (on)
+  {
+  case CMD_On:
+    return PSTR("ON");
+  case CMD_Off:
+    return PSTR("OFF");
+  case CMD_Bright:
+    return PSTR("BRIGHT");
+  case CMD_Dim:
+    return PSTR("DIM");
+  case CMD_Up:
+    return PSTR("UP");
+  case CMD_Down:
+    return PSTR("DOWN");
+  case CMD_Stop:
+    return PSTR("STOP");
+  case CMD_Pair:
+    return PSTR("PAIR");
+  case CMD_Unknown:
+  default:
+    return PSTR("UNKNOWN");
+  }
+}
+
+/**
+ * @return text of the states, nullptr for numbers and unknown states
+ * */
+static PGM_P stateName(byte format, unsigned long value)
+{
+  switch (format)
+  {
+  case Format_Battery:
+    return value ? PSTR("OK") : PSTR("LOW");
+  case Format_OnOff:
+    return value ? PSTR("ON") : PSTR("OFF");
+  case Format_Trend:
+    if (value == TREND_Stable)
+      return PSTR("STABLE");
+    if (value == TREND_Up)
+      return PSTR("UP");
+    if (value == TREND_Down)
+      return PSTR("DOWN");
+  }
+  return nullptr;
+}
+
+static bool appendTextValue(OutputBuilder &output, const ValueDescriptor &descriptor, unsigned long value)
+{
+  switch (descriptor.format)
+  {
+  case Format_Hex2:
+    return output.appendf_P(PSTR(";%s=%02x"), descriptor.name, (unsigned int)value);
+  case Format_Hex4:
+    return output.appendf_P(PSTR(";%s=%04x"), descriptor.name, (unsigned int)value);
+  case Format_Dec2:
+    return output.appendf_P(PSTR(";%s=%02d"), descriptor.name, (int)value);
+  case Format_Dec3:
+    return output.appendf_P(PSTR(";%s=%03d"), descriptor.name, (int)value);
+  case Format_Dec4:
+    return output.appendf_P(PSTR(";%s=%04d"), descriptor.name, (int)value);
+  case Format_TempD:
+  {
+    long input = (long)value;
+    long absolute = (input < 0) ? -input : input;
+    return output.appendf_P(PSTR(";%s=%c%ld.%ld"), descriptor.name, (input < 0) ? '-' : '+', absolute / 10, absolute % 10);
+  }
+  default:
+    PGM_P state = stateName(descriptor.format, value);
+    if (state == nullptr)
+      return true; // nothing to tell
+    return output.appendf_P(PSTR(";%s=%s"), descriptor.name, state);
+  }
+}
+
+bool formatEventText(const EventRecord &event, OutputBuilder &output, bool countTruncated)
+{
+  output.begin();
+  output.appendf_P(PSTR("20;%02X"), event.sequence);
+
+  DecodedField field;
+  ValueDescriptor descriptor;
+  for (const uint8_t *data = event.data; data < event.data + event.size;)
+  {
+    data = decodeField(data, field);
+    switch (field.type)
+    {
+    case Field_Name:
+      output.appendf_P(PSTR(";%s"), field.str);
+      break;
+    case Field_NameEx:
+      output.appendf_P(PSTR(";%s-%04X"), field.str, (unsigned int)field.number);
+      break;
+    case Field_Splash:
+      output.appendf_P(PSTR("%s%d.%d;BUILD=%s"), PSTR(";RFLink_ESP;VER="), BUILDNR, REVNR, PSTR(RFLINK_BUILDNAME));
+      break;
+    case Field_ID:
+      output.appendf_P(PSTR(";ID=%0*lx"), field.extra, field.number);
+      break;
+    case Field_IDc:
+      output.appendf_P(PSTR(";ID=%s"), field.str);
+      break;
+    case Field_Switch:
+      output.appendf_P(PSTR(";SWITCH=%02x"), (unsigned int)field.number);
+      break;
+    case Field_SwitchC:
+      output.appendf_P(PSTR(";SWITCH=%s"), field.str);
+      break;
+    case Field_Cmd:
+      output.appendf_P(PSTR(";CMD=%s%s"), (field.extra == CMD_All) ? PSTR("ALL") : PSTR(""), commandName(field.number));
+      break;
+    case Field_Value:
+      memcpy_P(&descriptor, &valueDescriptors[field.extra], sizeof(descriptor));
+      appendTextValue(output, descriptor, field.number);
+      break;
+    case Field_Debug:
+      if (!output.append_P(PSTR(";DEBUG=")))
+        break;
+      for (byte i = 0; i < field.extra; i++)
+      {
+        if (!output.appendf_P(PSTR("%02x"), field.bytes[i]))
+          break;
+      }
+      break;
+    case Field_Custom:
+      output.appendf_P(PSTR(";%s=%lx"), field.str, field.number);
+      break;
+    }
+  }
+  output.append_P(PSTR(";\r\n"), true);
+
+  if (event.truncated || output.isTruncated())
+  {
+    if (countTruncated)
+      display_TruncatedMessagesCount++;
+    return false;
+  }
+  return true;
+}
+
+static bool appendJsonString(OutputBuilder &output, PGM_P key, const char *value)
+{
+  char escaped[2 * EVENT_RECORD_SIZE + 1];
+  size_t length = 0;
+
+  for (; *value != 0 && length < sizeof(escaped) - 2; value++)
+  {
+    if (*value == '"' || *value == '\\')
+      escaped[length++] = '\\';
+    if ((unsigned char)*value >= ' ')
+      escaped[length++] = *value;
+  }
+  escaped[length] = 0;
+  return output.appendf_P(PSTR(",\"%s\":\"%s\""), key, escaped);
+}
+
+static bool appendJsonValue(OutputBuilder &output, const ValueDescriptor &descriptor, unsigned long value)
+{
+  char key[sizeof(descriptor.name)];
+  for (byte i = 0; i < sizeof(key); i++)
+    key[i] = tolower(descriptor.name[i]);
+
+  bool negative = false;
+  switch (descriptor.scale)
+  {
+  case Scale_SignedTenths:
+    negative = (value & 0x8000) != 0;
+    value &= 0x7FFF;
+    break;
+  case Scale_IntTenths:
+    negative = (long)value < 0;
+    if (negative)
+      value = -(long)value;
+    break;
+  case Scale_Tenths:
+    break;
+  default:
+    PGM_P state = stateName(descriptor.format, value);
+    if (state != nullptr)
+      return output.appendf_P(PSTR(",\"%s\":\"%s\""), key, state);
+    if (descriptor.format == Format_Trend)
+      return true; // nothing to tell
+    return output.appendf_P(PSTR(",\"%s\":%lu"), key, value);
+  }
+  return output.appendf_P(PSTR(",\"%s\":%s%lu.%lu"), key, negative ? "-" : "", value / 10, value % 10);
+}
+
+bool formatEventJson(const EventRecord &event, OutputBuilder &output)
+{
+  output.begin();
+  output.appendf_P(PSTR("{\"seq\":%u"), event.sequence);
+
+  DecodedField field;
+  ValueDescriptor descriptor;
+  char text[12];
+  for (const uint8_t *data = event.data; data < event.data + event.size;)
+  {
+    data = decodeField(data, field);
+    switch (field.type)
+    {
+    case Field_Name:
+      appendJsonString(output, PSTR("name"), field.str);
+      break;
+    case Field_NameEx:
+      output.appendf_P(PSTR(",\"name\":\"%s-%04X\""), field.str, (unsigned int)field.number);
+      break;
+    case Field_Splash:
+      output.appendf_P(PSTR(",\"name\":\"RFLink_ESP\",\"ver\":\"%d.%d\",\"build\":\"%s\""), BUILDNR, REVNR, PSTR(RFLINK_BUILDNAME));
+      break;
+    case Field_ID:
+      snprintf_P(text, sizeof(text), PSTR("%0*lx"), field.extra, field.number);
+      appendJsonString(output, PSTR("id"), text);
+      break;
+    case Field_IDc:
+      appendJsonString(output, PSTR("id"), field.str);
+      break;
+    case Field_Switch:
+      snprintf_P(text, sizeof(text), PSTR("%02x"), (unsigned int)field.number);
+      appendJsonString(output, PSTR("switch"), text);
+      break;
+    case Field_SwitchC:
+      appendJsonString(output, PSTR("switch"), field.str);
+      break;
+    case Field_Cmd:
+      output.appendf_P(PSTR(",\"cmd\":\"%s%s\""), (field.extra == CMD_All) ? PSTR("ALL") : PSTR(""), commandName(field.number));
+      break;
+    case Field_Value:
+      memcpy_P(&descriptor, &valueDescriptors[field.extra], sizeof(descriptor));
+      appendJsonValue(output, descriptor, field.number);
+      break;
+    case Field_Debug:
+      if (!output.append_P(PSTR(",\"debug\":\"")))
+        break;
+      for (byte i = 0; i < field.extra; i++)
+      {
+        if (!output.appendf_P(PSTR("%02x"), field.bytes[i]))
+          break;
+      }
+      output.append_P(PSTR("\""));
+      break;
+    case Field_Custom:
+      output.appendf_P(PSTR(",\"%s\":%lu"), field.str, field.number);
+      break;
+    }
+  }
+  output.append_P(PSTR("}"), true);
+
+  return !event.truncated && !output.isTruncated();
+}
+
+// ------------------- //
+// Message queue       //
+// ------------------- //
+
+bool MessageQueue::push(const EventRecord &event)
+{
+  byte nextHead = (head + 1) % OUTPUT_QUEUE_SIZE;
+  if (nextHead == tail)
+  { // sinks are late and all slots are taken, this one is lost
+    droppedCount++;
+    return false;
+  }
+
+  memcpy(&events[head], &event, offsetof(EventRecord, data) + event.size);
+  delivered[head] = 0;
+  __sync_synchronize(); // event must be visible before it is published
+  head = nextHead;
+
+  byte depth = (head + OUTPUT_QUEUE_SIZE - tail) % OUTPUT_QUEUE_SIZE;
+  if (depth > maxDepth)
+    maxDepth = depth;
+  return true;
+}
+
+const EventRecord *MessageQueue::peek(byte position)
+{
+  if (position >= (head + OUTPUT_QUEUE_SIZE - tail) % OUTPUT_QUEUE_SIZE)
+    return nullptr;
+  __sync_synchronize();
+  return &events[(tail + position) % OUTPUT_QUEUE_SIZE];
+}
+
+byte &MessageQueue::deliveredTo(byte position)
+{
+  return delivered[(tail + position) % OUTPUT_QUEUE_SIZE];
+}
+
+void MessageQueue::pop()
+{
+  if (isEmpty())
+    return;
+  __sync_synchronize();
+  tail = (tail + 1) % OUTPUT_QUEUE_SIZE; // slot can now be reused by producers
+}
+
+void MessageQueue::clear()
+{
+  tail = head;
+}
 
 // ------------------- //
 // Display shared func //
@@ -25,392 +599,296 @@ char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for complete message data
 // Common Header
 void display_Header(void)
 {
-  sprintf_P(dbuffer, PSTR("%s%02X"), PSTR("20;"), PKSequenceNumber++);
-  strcat(pbuffer, dbuffer);
+  event.sequence = PKSequenceNumber++;
+  event.size = 0; // drop what is left of an event that was never completed
+  event.truncated = false;
 }
 
 // Plugin Name
 void display_Name(const char *input)
 {
-  sprintf_P(dbuffer, PSTR(";%s"), input);
-  strcat(pbuffer, dbuffer);
+  recordString(Field_Name, input);
 }
 
 void display_NameEx(const char *name, unsigned int id)
 {
-  sprintf_P(dbuffer, PSTR(";%s-%04X"), name, id);
-  strcat(pbuffer, dbuffer);
+  uint8_t *field = recordString(Field_NameEx, name, 4);
+  if (field != nullptr)
+    putLong(field, id, 4);
 }
 
 // Common Footer
 void display_Footer(void)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";\r\n"));
-  strcat(pbuffer, dbuffer);
+  outputQueue.push(event);
+  event.size = 0;
 }
 
 // Start message
 void display_Splash(void)
 {
-  sprintf_P(dbuffer, PSTR("%s%d.%d;BUILD=%s"), PSTR(";RFLink_ESP;VER="), BUILDNR, REVNR, PSTR(RFLINK_BUILDNAME));
-  strcat(pbuffer, dbuffer);
+  reserveField(Field_Splash, 0);
 }
 
 // ID=9999 => device ID (often a rolling code and/or device channel number) (Hexadecimal)
 void display_IDn(unsigned long input, byte n)
 {
-  switch (n)
-  {
-  case 2:
-    sprintf_P(dbuffer, PSTR("%s%02lx"), PSTR(";ID="), input);
-    break;
-  case 4:
-    sprintf_P(dbuffer, PSTR("%s%04lx"), PSTR(";ID="), input);
-    break;
-  case 6:
-    sprintf_P(dbuffer, PSTR("%s%06lx"), PSTR(";ID="), input);
-    break;
-  case 8:
-  default:
-    sprintf_P(dbuffer, PSTR("%s%08lx"), PSTR(";ID="), input);
-  }
-  strcat(pbuffer, dbuffer);
+  uint8_t *field = reserveField(Field_ID, 5);
+  if (field == nullptr)
+    return;
+
+  putLong(field, input, 4);
+  field[4] = (n == 2 || n == 4 || n == 6) ? n : 8;
 }
 
 void display_IDc(const char *input)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";ID="));
-  strcat(pbuffer, dbuffer);
-  strcat(pbuffer, input);
+  recordString(Field_IDc, input);
 }
 
 // SWITCH=A16 => House/Unit code like A1, P2, B16 or a button number etc.
 void display_SWITCH(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";SWITCH="), input);
-  strcat(pbuffer, dbuffer);
+  uint8_t *field = reserveField(Field_Switch, 1);
+  if (field != nullptr)
+    field[0] = input;
 }
 
 // SWITCH=A16 => House/Unit code like A1, P2, B16 or a button number etc.
 void display_SWITCHc(const char *input)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";SWITCH="));
-  strcat(pbuffer, dbuffer);
-  strcat(pbuffer, input);
+  recordString(Field_SwitchC, input);
 }
 
 // CMD=ON => Command (ON/OFF/ALLON/ALLOFF) Additional for Milight: DISCO+/DISCO-/MODE0 - MODE8
 void display_CMD(boolean all, byte on)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";CMD="));
-  strcat(pbuffer, dbuffer);
+  uint8_t *field = reserveField(Field_Cmd, 2);
+  if (field == nullptr)
+    return;
 
-  if (all == CMD_All)
-  {
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("ALL"));
-    strcat(pbuffer, dbuffer);
-  }
-
-  switch (on)
-  {
-  case CMD_On:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("ON"));
-    break;
-  case CMD_Off:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("OFF"));
-    break;
-  case CMD_Bright:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("BRIGHT"));
-    break;
-  case CMD_Dim:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("DIM"));
-    break;
-  case CMD_Up:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("UP"));
-    break;
-  case CMD_Down:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("DOWN"));
-    break;
-  case CMD_Stop:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("STOP"));
-    break;
-  case CMD_Pair:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("PAIR"));
-    break;
-  case CMD_Unknown:
-  default:
-    sprintf_P(dbuffer, PSTR("%s"), PSTR("UNKNOWN"));
-  }
-  strcat(pbuffer, dbuffer);
+  field[0] = (all == CMD_All) ? CMD_All : CMD_Single;
+  field[1] = on;
 }
 
 // SET_LEVEL=15 => Direct dimming level setting value (decimal value: 0-15)
 void display_SET_LEVEL(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02d"), PSTR(";SET_LEVEL="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_SET_LEVEL, input);
 }
 
 // TEMP=9999 => Temperature celcius (hexadecimal), high bit contains negative sign, needs division by 10
 void display_TEMP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";TEMP="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_TEMP, input);
 }
 
 // TEMP=+999.9 => Temperature celcius (decimal +-ddd.d), no conversion needed
 void display_TEMPD(int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%+03d."), PSTR(";TEMPD="), input);
-  int l = strlen(dbuffer);
-  dbuffer[l - 1] = dbuffer[l - 2];
-  dbuffer[l - 2] = '.';
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_TEMPD, (unsigned long)(long)input);
 }
 
 // HUM=99 => Humidity (decimal value: 0-100 to indicate relative humidity in %)
 void display_HUM(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02d"), PSTR(";HUM="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_HUM, input);
 }
 
 // BARO=9999 => Barometric pressure (hexadecimal)
 void display_BARO(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";BARO="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_BARO, input);
 }
 
 // HSTATUS=99 => 0=Normal, 1=Comfortable, 2=Dry, 3=Wet
 void display_HSTATUS(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";HSTATUS="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_HSTATUS, input);
 }
 
 // BFORECAST=99 => 0=No Info/Unknown, 1=Sunny, 2=Partly Cloudy, 3=Cloudy, 4=Rain
 void display_BFORECAST(byte input)
 {
-  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";BFORECAST="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_BFORECAST, input);
 }
 
 // UV=9999 => UV intensity (hexadecimal)
 void display_UV(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";UV="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_UV, input);
 }
 
 // LUX=9999 => Light intensity (hexadecimal)
 void display_LUX(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";LUX="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_LUX, input);
 }
 
 // BAT=OK => Battery status indicator (OK/LOW)
 void display_BAT(boolean input)
 {
-  if (input == true)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";BAT=OK"));
-  else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";BAT=LOW"));
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_BAT, input == true);
 }
 
 // RAIN=1234 => Total rain in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
 void display_RAIN(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RAIN="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_RAIN, input);
 }
 
 // RAINTOT=1234 => Total rain in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
 void display_RAINTOT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RAINTOT="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_RAINTOT, input);
 }
 
 // RAINRATE=1234 => Rain rate in mm. (hexadecimal) 0x8d = 141 decimal = 14.1 mm (needs division by 10)
 void display_RAINRATE(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RAINRATE="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_RAINRATE, input);
 }
 
 // WINSP=9999 => Wind speed in km. p/h (hexadecimal) needs division by 10
 void display_WINSP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINSP="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_WINSP, input);
 }
 
 // AWINSP=9999 => Average Wind speed in km. p/h (hexadecimal) needs division by 10
 void display_AWINSP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";AWINSP="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_AWINSP, input);
 }
 
 // WINGS=9999 => Wind Gust in km. p/h (hexadecimal)
 void display_WINGS(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINGS="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_WINGS, input);
 }
 
 // WINDIR=123 => Wind direction (integer value from 0-15) reflecting 0-360 degrees in 22.5 degree steps
 void display_WINDIR(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%03d"), PSTR(";WINDIR="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_WINDIR, input);
 }
 
 // WINCHL => wind chill (hexadecimal, see TEMP)
 void display_WINCHL(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINCHL="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_WINCHL, input);
 }
 
 // WINTMP=1234 => Wind meter temperature reading (hexadecimal, see TEMP)
 void display_WINTMP(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WINTMP="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_WINTMP, input);
 }
 
 // CHIME=123 => Chime/Doorbell melody number
 void display_CHIME(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%03d"), PSTR(";CHIME="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_CHIME, input);
 }
 
 // TREND => Temperature trend (UP/DOWN/STABLE)
 void display_TREND(byte input)
 {
-  switch (input) {
-    case TREND_Stable:
-      sprintf_P(dbuffer, PSTR("%s"), PSTR(";TREND=STABLE"));
-      break;
-    case TREND_Up:
-      sprintf_P(dbuffer, PSTR("%s"), PSTR(";TREND=UP"));
-      break;
-    case TREND_Down:
-      sprintf_P(dbuffer, PSTR("%s"), PSTR(";TREND=DOWN"));
-      break;
-  }
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_TREND, input);
 }
 
 // SMOKEALERT=ON => ON/OFF
 void display_SMOKEALERT(boolean input)
 {
-  if (input == SMOKE_On)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";SMOKEALERT=ON"));
-  else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";SMOKEALERT=OFF"));
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_SMOKEALERT, input == SMOKE_On);
 }
 
 // PIR=ON => ON/OFF
 void display_PIR(boolean input)
 {
-  if (input == PIR_On)
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";PIR=ON"));
-  else
-    sprintf_P(dbuffer, PSTR("%s"), PSTR(";PIR=OFF"));
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_PIR, input == PIR_On);
 }
 
 // CO2=1234 => CO2 air quality
 void display_CO2(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";CO2="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_CO2, input);
 }
 
 // SOUND=1234 => Noise level
 void display_SOUND(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";SOUND="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_SOUND, input);
 }
 
 // KWATT=9999 => KWatt (hexadecimal)
 void display_KWATT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";KWATT="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_KWATT, input);
 }
 
 // WATT=9999 => Watt (hexadecimal)
 void display_WATT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";WATT="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_WATT, input);
 }
 
 // CURRENT=1234 => Current phase 1
 void display_CURRENT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";CURRENT="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_CURRENT, input);
 }
 
 // DIST=1234 => Distance
 void display_DIST(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";DIST="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_DIST, input);
 }
 
 // METER=1234 => Meter values (water/electricity etc.)
 void display_METER(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";METER="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_METER, input);
 }
 
 // VOLT=1234 => Voltage
 void display_VOLT(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04d"), PSTR(";VOLT="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_VOLT, input);
 }
 
 // RGBW=9999 => Milight: provides 1 byte color and 1 byte brightness value
 void display_RGBW(unsigned int input)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";RGBW="), input);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_RGBW, input);
 }
 
 
 // Channel
 void display_CHAN(byte channel)
 {
-  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";CHN="), channel);
-  strcat(pbuffer, dbuffer);
+  recordValue(Value_CHN, channel);
+}
+
+// NAME=1234 => Any other field, e.g. from Flex rules (hexadecimal)
+void display_Field(const char *name, unsigned long value)
+{
+  uint8_t *field = recordString(Field_Custom, name, 4);
+  if (field != nullptr)
+    putLong(field, value, 4);
 }
 
 // DEBUG=..... => provide DEBUG Data
 void display_DEBUG(byte data[], unsigned int size)
 {
-  sprintf_P(dbuffer, PSTR("%s"), PSTR(";DEBUG="));
-  strcat(pbuffer, dbuffer);
-
-  char buffer[size*2 + 1];
-  for (unsigned int i = 0; i < size; i++)
-  {
-    sprintf_P(buffer+i*2, PSTR("%02x"), data[i]);
-  }
+  if (size > 255)
+    size = 255;
+  uint8_t *field = reserveField(Field_Debug, 1 + size);
+  if (field == nullptr)
+    return;
 
-  strcat(pbuffer, buffer);
+  field[0] = size;
+  memcpy(field + 1, data, size);
 }
 
 // --------------------- //
@@ -820,3 +1298,119 @@ String GPIO2String(uint8_t uGPIO)
     return "NOT_A_PIN";
 }
 #endif // ESP32
+
+#ifdef _TEST
+#include <time.h>
+
+// Builds the same message with the former sprintf_P() + strcat() path and with display_* functions
+static void legacyMessage(char *dbuffer)
+{
+  pbuffer[0] = 0;
+  sprintf_P(dbuffer, PSTR("%s%02X"), PSTR("20;"), PKSequenceNumber++);
+  strcat(pbuffer, dbuffer);
+  sprintf_P(dbuffer, PSTR(";%s"), PSTR("Oregon TempHygro"));
+  strcat(pbuffer, dbuffer);
+  sprintf_P(dbuffer, PSTR("%s%04lx"), PSTR(";ID="), 0x1A2DUL);
+  strcat(pbuffer, dbuffer);
+  sprintf_P(dbuffer, PSTR("%s%04x"), PSTR(";TEMP="), 0x00D7);
+  strcat(pbuffer, dbuffer);
+  sprintf_P(dbuffer, PSTR("%s%02d"), PSTR(";HUM="), 47);
+  strcat(pbuffer, dbuffer);
+  sprintf_P(dbuffer, PSTR("%s%02x"), PSTR(";HSTATUS="), 2);
+  strcat(pbuffer, dbuffer);
+  sprintf_P(dbuffer, PSTR("%s"), PSTR(";BAT=OK"));
+  strcat(pbuffer, dbuffer);
+  sprintf_P(dbuffer, PSTR("%s"), PSTR(";\r\n"));
+  strcat(pbuffer, dbuffer);
+}
+
+static void builderMessage()
+{
+  display_Header();
+  display_Name(PSTR("Oregon TempHygro"));
+  display_IDn(0x1A2D, 4);
+  display_TEMP(0x00D7);
+  display_HUM(47);
+  display_HSTATUS(2);
+  display_BAT(true);
+  display_Footer();
+}
+
+static const char *formatText(const EventRecord *event)
+{
+  pbuffer[0] = 0;
+  formatEventText(*event, pbufferBuilder);
+  return pbuffer;
+}
+
+int main(int argc, char **argv)
+{
+  const int rounds = 200000;
+  char dbuffer[60];
+  char expected[PRINT_BUFFER_SIZE];
+  int failures = 0;
+
+  PKSequenceNumber = 0;
+  legacyMessage(dbuffer);
+  strcpy(expected, pbuffer);
+  PKSequenceNumber = 0;
+  builderMessage();
+  bool same = strcmp(expected, formatText(outputQueue.peek())) == 0;
+  fprintf(stderr, "display:: same output: %s\r\n", same ? "yes" : "NO");
+  failures += !same;
+
+  static char json[256];
+  OutputBuilder jsonBuilder(json, sizeof(json), 2);
+  formatEventJson(*outputQueue.peek(), jsonBuilder);
+  fprintf(stderr, "display:: json: %s\r\n", json);
+  outputQueue.pop();
+
+  clock_t start = clock();
+  for (int i = 0; i < rounds; i++)
+    legacyMessage(dbuffer);
+  double legacy_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / rounds;
+
+  start = clock();
+  for (int i = 0; i < rounds; i++)
+  {
+    builderMessage();
+    outputQueue.pop();
+  }
+  double record_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / rounds;
+
+  start = clock();
+  for (int i = 0; i < rounds; i++)
+  {
+    builderMessage();
+    formatText(outputQueue.peek());
+    outputQueue.pop();
+  }
+  double text_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / rounds;
+
+  fprintf(stderr, "display:: sprintf_P + strcat: %.0f ns/message\r\n", legacy_ns);
+  fprintf(stderr, "display:: event record:       %.0f ns/message\r\n", record_ns);
+  fprintf(stderr, "display:: record + text:      %.0f ns/message\r\n", text_ns);
+
+  display_Header();
+  for (int i = 0; i < 40; i++)
+    display_TEMP(i);
+  display_Footer();
+  const char *message = formatText(outputQueue.peek());
+  bool footer = strcmp(message + strlen(message) - 3, ";\r\n") == 0;
+  fprintf(stderr, "display:: overflow: length=%u truncated=%lu ends with footer: %s\r\n", (unsigned)strlen(message),
+          display_TruncatedMessagesCount, footer ? "yes" : "NO");
+  failures += !footer;
+  outputQueue.pop();
+
+  // sinks which do not keep up lose the newest events, never a part of one
+  for (int i = 0; i < OUTPUT_QUEUE_SIZE + 2; i++)
+    builderMessage();
+  unsigned int queued = 0;
+  for (; !outputQueue.isEmpty(); outputQueue.pop())
+    queued++;
+  fprintf(stderr, "display:: queue: %u messages kept, %lu dropped, max depth %u\r\n", queued, outputQueue.droppedCount, outputQueue.maxDepth);
+  failures += queued + outputQueue.droppedCount != OUTPUT_QUEUE_SIZE + 2;
+
+  return failures != 0;
+}
+#endif /* _TEST */
@@ -13,12 +13,165 @@
 #define PRINT_BUFFER_SIZE 120 // 90         // Maximum number of characters that a command should print in one go via the print buffer.
 
 // extern byte PKSequenceNumber;     // 1 byte packet counter
-extern char pbuffer[PRINT_BUFFER_SIZE]; // Buffer for printing data
+extern char pbuffer[PRINT_BUFFER_SIZE]; // Text of the event being sent, see RFLink::sendMsgFromBuffer()
+
+/**
+ * Appends fields to a fixed size buffer through a write cursor, each field being formatted in place.
+ * A field which does not fit is dropped as a whole and the message is flagged as truncated,
+ * 'reserved' bytes are kept for the message footer.
+ * If someone else writes to the buffer (strcat, pbuffer[0] = 0) the cursor is recomputed on next append.
+ * */
+class OutputBuilder
+{
+public:
+    OutputBuilder(char *buffer, size_t size, size_t reserved = 0);
+
+    void begin(); // starts a new message at the current end of the buffer
+    bool append_P(PGM_P str, bool useReserved = false);
+    bool append(const char *str);
+    bool appendf_P(PGM_P format, ...);
+    size_t length();
+
+    inline bool isTruncated() const { return truncated; }
+
+private:
+    char *buffer;
+    size_t size;
+    size_t reserved;
+    size_t cursor;
+    bool truncated;
+
+    size_t sync();
+    bool overflow();
+};
+
+extern OutputBuilder pbufferBuilder;               // formatEventText() writes to pbuffer through it
+extern unsigned long display_TruncatedMessagesCount; // messages which did not fit in EVENT_RECORD_SIZE or PRINT_BUFFER_SIZE
+
+#define EVENT_RECORD_SIZE 112 // Bytes of fields in a decoded event, binary fields are shorter than their text
+#define OUTPUT_QUEUE_SIZE 8   // Slots of complete events waiting for the output sinks, one is always kept free
+
+/**
+ * Decoded event as the display_* functions record it, formatted only by the sinks which need it:
+ * formatEventText() gives the legacy "20;XX;...;" line, formatEventJson() a JSON object.
+ * data holds the fields in the order they were displayed, each one a EventField byte followed by its value.
+ * Integers are little endian, strings are zero terminated:
+ *   Field_Name, Field_IDc, Field_SwitchC: string
+ *   Field_NameEx: string, uint32 id
+ *   Field_Splash: nothing
+ *   Field_ID: uint32 id, byte number of hex digits
+ *   Field_Switch: byte
+ *   Field_Cmd: byte CMD_Group, byte CMD_OnOff
+ *   Field_Value: byte EventValue, uint32 value (fixed point as the plugin gave it, see display_* comments)
+ *   Field_Debug: byte length, bytes
+ *   Field_Custom: string name, uint32 value
+ * A field which does not fit is dropped and the event is flagged as truncated.
+ * */
+struct EventRecord
+{
+    byte sequence; // 20;XX; packet counter
+    byte size;     // bytes used in data
+    bool truncated;
+    uint8_t data[EVENT_RECORD_SIZE];
+};
+
+enum EventField
+{
+    Field_Name = 1,
+    Field_NameEx,
+    Field_Splash,
+    Field_ID,
+    Field_IDc,
+    Field_Switch,
+    Field_SwitchC,
+    Field_Cmd,
+    Field_Value,
+    Field_Debug,
+    Field_Custom
+};
+
+enum EventValue
+{
+    Value_CHN,
+    Value_SET_LEVEL,
+    Value_TEMP,
+    Value_TEMPD,
+    Value_HUM,
+    Value_BARO,
+    Value_HSTATUS,
+    Value_BFORECAST,
+    Value_UV,
+    Value_LUX,
+    Value_BAT,
+    Value_RAIN,
+    Value_RAINTOT,
+    Value_RAINRATE,
+    Value_WINSP,
+    Value_AWINSP,
+    Value_WINGS,
+    Value_WINDIR,
+    Value_WINCHL,
+    Value_WINTMP,
+    Value_CHIME,
+    Value_TREND,
+    Value_SMOKEALERT,
+    Value_PIR,
+    Value_CO2,
+    Value_SOUND,
+    Value_KWATT,
+    Value_WATT,
+    Value_CURRENT,
+    Value_DIST,
+    Value_METER,
+    Value_VOLT,
+    Value_RGBW,
+    EventValue_EOF
+};
+
+/**
+ * Append the event to output, which is not cleared first
+ * @param countTruncated adds a truncated event to display_TruncatedMessagesCount, once per event
+ * @return false if the event or its text was truncated
+ * */
+bool formatEventText(const EventRecord &event, OutputBuilder &output, bool countTruncated = true);
+bool formatEventJson(const EventRecord &event, OutputBuilder &output);
+
+/**
+ * Fixed size ring of complete events, between display_Footer() which pushes the event being recorded
+ * and RFLink::sendMsgFromBuffer() which hands them over to Serial, MQTT, Serial2Net and OLED.
+ * Producers are serialised by Signal::ScanTask::lock() and the main loop is the only consumer, so decoding
+ * never waits for the sinks. Each slot keeps the sinks its event was handed to, an event stays queued until
+ * all of them got it. An event which finds the ring full is dropped.
+ * */
+class MessageQueue
+{
+public:
+    bool push(const EventRecord &event);
+    const EventRecord *peek(byte position = 0); // position-th oldest event, nullptr if none, valid until popped
+    byte &deliveredTo(byte position = 0);        // sinks mask of the position-th oldest event, 0 when pushed
+    void pop();
+    void clear();
+    inline bool isEmpty() const { return head == tail; }
+    inline bool isFull() const { return (head + 1) % OUTPUT_QUEUE_SIZE == tail; }
+
+    unsigned long droppedCount = 0;
+    unsigned long skippedCount = 0; // events a late sink gave up, so that the others don't lose new ones
+    byte maxDepth = 0;              // highest number of events waiting at once
+
+private:
+    EventRecord events[OUTPUT_QUEUE_SIZE];
+    byte delivered[OUTPUT_QUEUE_SIZE];
+    volatile byte head = 0; // written by producers only
+    volatile byte tail = 0; // written by the consumer only
+};
+
+extern MessageQueue outputQueue;
 
 void display_Header(void);
 void display_Name(const char *);
 void display_NameEx(const char *name, unsigned int id);
 void display_Footer(void);
+void display_Field(const char *name, unsigned long value); // NAME=value (hexadecimal), for fields without a display_* function
 void display_Splash(void);
 void display_IDn(unsigned long, byte);
 void display_IDc(const char *);
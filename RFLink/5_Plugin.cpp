@@ -19,9 +19,12 @@ using namespace RFLink;
 boolean (*Plugin_ptr[PLUGIN_MAX])(byte, const char *); // Receive plugins
 byte Plugin_id[PLUGIN_MAX];
 byte Plugin_State[PLUGIN_MAX];
+PluginDispatchResult DispatchResult;
 #ifndef ARDUINO_AVR_UNO // Optimize memory limite to 2048 bytes on arduino uno
 const char* Plugin_Description[PLUGIN_MAX];
 #endif
+const PluginPulseRange *Plugin_PulseRanges[PLUGIN_MAX];
+byte Plugin_PulseRangesCount[PLUGIN_MAX];
 
 boolean (*PluginTX_ptr[PLUGIN_TX_MAX])(byte, const char *); // Trasmit plugins
 byte PluginTX_id[PLUGIN_TX_MAX];
@@ -542,6 +545,13 @@ boolean QRFUDebug = QRFUDebug_0; // debug RF signals with plugin 254 but no mult
 #include "./Plugins/Plugin_255.c"
 #endif
 /*********************************************************************************************/
+#define PLUGIN_DECLARE_PULSES(index, ...)                                     \
+  {                                                                           \
+    static const PluginPulseRange ranges[] PROGMEM = {__VA_ARGS__};           \
+    Plugin_PulseRanges[index] = ranges;                                       \
+    Plugin_PulseRangesCount[index] = sizeof(ranges) / sizeof(ranges[0]);      \
+  }
+
 void PluginInit(void)
 {
   byte x;
@@ -552,6 +562,8 @@ void PluginInit(void)
     Plugin_ptr[x] = 0;
     Plugin_id[x] = 0;
     Plugin_State[x] = P_Disabled;
+    Plugin_PulseRanges[x] = nullptr;
+    Plugin_PulseRangesCount[x] = 0;
   }
 
   x = 0;
@@ -562,6 +574,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_001);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_001
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_001);
+#endif
   Plugin_ptr[x++] = &Plugin_001;
 #endif
 
@@ -571,6 +586,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_002);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_002
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_002);
+#endif
   Plugin_ptr[x++] = &Plugin_002;
 #endif
 
@@ -580,6 +598,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_003);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_003
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_003);
+#endif
   Plugin_ptr[x++] = &Plugin_003;
 #endif
 
@@ -589,6 +610,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_004);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_004
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_004);
+#endif
   Plugin_ptr[x++] = &Plugin_004;
 #endif
 
@@ -598,6 +622,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_005);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_005
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_005);
+#endif
   Plugin_ptr[x++] = &Plugin_005;
 #endif
 
@@ -607,6 +634,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_006);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_006
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_006);
+#endif
   Plugin_ptr[x++] = &Plugin_006;
 #endif
 
@@ -616,6 +646,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_007);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_007
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_007);
+#endif
   Plugin_ptr[x++] = &Plugin_007;
 #endif
 
@@ -625,6 +658,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_008);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_008
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_008);
+#endif
   Plugin_ptr[x++] = &Plugin_008;
 #endif
 
@@ -634,6 +670,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_009);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_009
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_009);
+#endif
   Plugin_ptr[x++] = &Plugin_009;
 #endif
 
@@ -643,6 +682,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_010);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_010
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_010);
+#endif
   Plugin_ptr[x++] = &Plugin_010;
 #endif
 
@@ -652,6 +694,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_011);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_011
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_011);
+#endif
   Plugin_ptr[x++] = &Plugin_011;
 #endif
 
@@ -661,6 +706,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_012);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_012
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_012);
+#endif
   Plugin_ptr[x++] = &Plugin_012;
 #endif
 
@@ -670,6 +718,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_013);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_013
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_013);
+#endif
   Plugin_ptr[x++] = &Plugin_013;
 #endif
 
@@ -679,6 +730,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_014);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_014
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_014);
+#endif
   Plugin_ptr[x++] = &Plugin_014;
 #endif
 
@@ -688,6 +742,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_015);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_015
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_015);
+#endif
   Plugin_ptr[x++] = &Plugin_015;
 #endif
 
@@ -697,6 +754,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_016);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_016
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_016);
+#endif
   Plugin_ptr[x++] = &Plugin_016;
 #endif
 
@@ -706,6 +766,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_017);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_017
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_017);
+#endif
   Plugin_ptr[x++] = &Plugin_017;
 #endif
 
@@ -715,6 +778,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_018);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_018
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_018);
+#endif
   Plugin_ptr[x++] = &Plugin_018;
 #endif
 
@@ -724,6 +790,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_019);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_019
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_019);
+#endif
   Plugin_ptr[x++] = &Plugin_019;
 #endif
 
@@ -733,6 +802,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_020);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_020
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_020);
+#endif
   Plugin_ptr[x++] = &Plugin_020;
 #endif
 
@@ -742,6 +814,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_021);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_021
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_021);
+#endif
   Plugin_ptr[x++] = &Plugin_021;
 #endif
 
@@ -751,6 +826,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_022);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_022
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_022);
+#endif
   Plugin_ptr[x++] = &Plugin_022;
 #endif
 
@@ -760,6 +838,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_023);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_023
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_023);
+#endif
   Plugin_ptr[x++] = &Plugin_023;
 #endif
 
@@ -769,6 +850,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_024);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_024
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_024);
+#endif
   Plugin_ptr[x++] = &Plugin_024;
 #endif
 
@@ -778,6 +862,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_025);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_025
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_025);
+#endif
   Plugin_ptr[x++] = &Plugin_025;
 #endif
 
@@ -787,6 +874,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_026);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_026
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_026);
+#endif
   Plugin_ptr[x++] = &Plugin_026;
 #endif
 
@@ -796,6 +886,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_027);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_027
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_027);
+#endif
   Plugin_ptr[x++] = &Plugin_027;
 #endif
 
@@ -805,6 +898,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_028);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_028
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_028);
+#endif
   Plugin_ptr[x++] = &Plugin_028;
 #endif
 
@@ -814,6 +910,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_029);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_029
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_029);
+#endif
   Plugin_ptr[x++] = &Plugin_029;
 #endif
 
@@ -823,6 +922,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_030);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_030
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_030);
+#endif
   Plugin_ptr[x++] = &Plugin_030;
 #endif
 
@@ -832,6 +934,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_031);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_031
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_031);
+#endif
   Plugin_ptr[x++] = &Plugin_031;
 #endif
 
@@ -841,6 +946,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_032);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_032
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_032);
+#endif
   Plugin_ptr[x++] = &Plugin_032;
 #endif
 
@@ -850,6 +958,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_033);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_033
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_033);
+#endif
   Plugin_ptr[x++] = &Plugin_033;
 #endif
 
@@ -859,6 +970,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_034);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_034
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_034);
+#endif
   Plugin_ptr[x++] = &Plugin_034;
 #endif
 
@@ -868,6 +982,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_035);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_035
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_035);
+#endif
   Plugin_ptr[x++] = &Plugin_035;
 #endif
 
@@ -877,6 +994,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_036);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_036
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_036);
+#endif
   Plugin_ptr[x++] = &Plugin_036;
 #endif
 
@@ -886,6 +1006,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_037);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_037
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_037);
+#endif
   Plugin_ptr[x++] = &Plugin_037;
 #endif
 
@@ -895,6 +1018,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_038);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_038
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_038);
+#endif
   Plugin_ptr[x++] = &Plugin_038;
 #endif
 
@@ -904,6 +1030,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_039);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_039
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_039);
+#endif
   Plugin_ptr[x++] = &Plugin_039;
 #endif
 
@@ -913,6 +1042,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_040);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_040
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_040);
+#endif
   Plugin_ptr[x++] = &Plugin_040;
 #endif
 
@@ -922,6 +1054,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_041);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_041
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_041);
+#endif
   Plugin_ptr[x++] = &Plugin_041;
 #endif
 
@@ -931,6 +1066,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_042);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_042
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_042);
+#endif
   Plugin_ptr[x++] = &Plugin_042;
 #endif
 
@@ -940,6 +1078,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_043);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_043
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_043);
+#endif
   Plugin_ptr[x++] = &Plugin_043;
 #endif
 
@@ -949,6 +1090,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_044);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_044
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_044);
+#endif
   Plugin_ptr[x++] = &Plugin_044;
 #endif
 
@@ -958,6 +1102,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_045);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_045
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_045);
+#endif
   Plugin_ptr[x++] = &Plugin_045;
 #endif
 
@@ -967,6 +1114,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_046);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_046
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_046);
+#endif
   Plugin_ptr[x++] = &Plugin_046;
 #endif
 
@@ -976,6 +1126,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_047);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_047
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_047);
+#endif
   Plugin_ptr[x++] = &Plugin_047;
 #endif
 
@@ -985,6 +1138,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_048);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_048
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_048);
+#endif
   Plugin_ptr[x++] = &Plugin_048;
 #endif
 
@@ -994,6 +1150,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_049);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_049
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_049);
+#endif
   Plugin_ptr[x++] = &Plugin_049;
 #endif
 
@@ -1003,6 +1162,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_050);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_050
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_050);
+#endif
   Plugin_ptr[x++] = &Plugin_050;
 #endif
 
@@ -1012,6 +1174,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_051);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_051
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_051);
+#endif
   Plugin_ptr[x++] = &Plugin_051;
 #endif
 
@@ -1021,6 +1186,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_052);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_052
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_052);
+#endif
   Plugin_ptr[x++] = &Plugin_052;
 #endif
 
@@ -1030,6 +1198,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_053);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_053
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_053);
+#endif
   Plugin_ptr[x++] = &Plugin_053;
 #endif
 
@@ -1039,6 +1210,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_054);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_054
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_054);
+#endif
   Plugin_ptr[x++] = &Plugin_054;
 #endif
 
@@ -1048,6 +1222,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_055);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_055
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_055);
+#endif
   Plugin_ptr[x++] = &Plugin_055;
 #endif
 
@@ -1057,6 +1234,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_056);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_056
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_056);
+#endif
   Plugin_ptr[x++] = &Plugin_056;
 #endif
 
@@ -1066,6 +1246,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_057);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_057
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_057);
+#endif
   Plugin_ptr[x++] = &Plugin_057;
 #endif
 
@@ -1075,6 +1258,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_058);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_058
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_058);
+#endif
   Plugin_ptr[x++] = &Plugin_058;
 #endif
 
@@ -1084,6 +1270,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_059);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_059
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_059);
+#endif
   Plugin_ptr[x++] = &Plugin_059;
 #endif
 
@@ -1093,6 +1282,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_060);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_060
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_060);
+#endif
   Plugin_ptr[x++] = &Plugin_060;
 #endif
 
@@ -1102,6 +1294,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_061);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_061
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_061);
+#endif
   Plugin_ptr[x++] = &Plugin_061;
 #endif
 
@@ -1111,6 +1306,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_062);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_062
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_062);
+#endif
   Plugin_ptr[x++] = &Plugin_062;
 #endif
 
@@ -1120,6 +1318,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_063);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_063
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_063);
+#endif
   Plugin_ptr[x++] = &Plugin_063;
 #endif
 
@@ -1129,6 +1330,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_064);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_064
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_064);
+#endif
   Plugin_ptr[x++] = &Plugin_064;
 #endif
 
@@ -1138,6 +1342,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_065);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_065
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_065);
+#endif
   Plugin_ptr[x++] = &Plugin_065;
 #endif
 
@@ -1147,6 +1354,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_066);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_066
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_066);
+#endif
   Plugin_ptr[x++] = &Plugin_066;
 #endif
 
@@ -1156,6 +1366,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_067);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_067
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_067);
+#endif
   Plugin_ptr[x++] = &Plugin_067;
 #endif
 
@@ -1165,6 +1378,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_068);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_068
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_068);
+#endif
   Plugin_ptr[x++] = &Plugin_068;
 #endif
 
@@ -1174,6 +1390,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_069);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_069
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_069);
+#endif
   Plugin_ptr[x++] = &Plugin_069;
 #endif
 
@@ -1183,6 +1402,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_070);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_070
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_070);
+#endif
   Plugin_ptr[x++] = &Plugin_070;
 #endif
 
@@ -1192,6 +1414,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_071);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_071
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_071);
+#endif
   Plugin_ptr[x++] = &Plugin_071;
 #endif
 
@@ -1201,6 +1426,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_072);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_072
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_072);
+#endif
   Plugin_ptr[x++] = &Plugin_072;
 #endif
 
@@ -1210,6 +1438,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_073);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_073
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_073);
+#endif
   Plugin_ptr[x++] = &Plugin_073;
 #endif
 
@@ -1219,6 +1450,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_074);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_074
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_074);
+#endif
   Plugin_ptr[x++] = &Plugin_074;
 #endif
 
@@ -1228,6 +1462,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_075);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_075
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_075);
+#endif
   Plugin_ptr[x++] = &Plugin_075;
 #endif
 
@@ -1237,6 +1474,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_076);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_076
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_076);
+#endif
   Plugin_ptr[x++] = &Plugin_076;
 #endif
 
@@ -1246,6 +1486,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_077);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_077
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_077);
+#endif
   Plugin_ptr[x++] = &Plugin_077;
 #endif
 
@@ -1255,6 +1498,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_078);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_078
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_078);
+#endif
   Plugin_ptr[x++] = &Plugin_078;
 #endif
 
@@ -1264,6 +1510,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_079);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_079
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_079);
+#endif
   Plugin_ptr[x++] = &Plugin_079;
 #endif
 
@@ -1273,6 +1522,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_080);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_080
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_080);
+#endif
   Plugin_ptr[x++] = &Plugin_080;
 #endif
 
@@ -1282,6 +1534,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_081);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_081
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_081);
+#endif
   Plugin_ptr[x++] = &Plugin_081;
 #endif
 
@@ -1291,6 +1546,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_082);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_082
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_082);
+#endif
   Plugin_ptr[x++] = &Plugin_082;
 #endif
 
@@ -1300,6 +1558,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_083);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_083
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_083);
+#endif
   Plugin_ptr[x++] = &Plugin_083;
 #endif
 
@@ -1309,6 +1570,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_084);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_084
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_084);
+#endif
   Plugin_ptr[x++] = &Plugin_084;
 #endif
 
@@ -1318,6 +1582,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_085);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_085
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_085);
+#endif
   Plugin_ptr[x++] = &Plugin_085;
 #endif
 
@@ -1327,6 +1594,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_086);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_086
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_086);
+#endif
   Plugin_ptr[x++] = &Plugin_086;
 #endif
 
@@ -1336,6 +1606,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_087);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_087
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_087);
+#endif
   Plugin_ptr[x++] = &Plugin_087;
 #endif
 
@@ -1345,6 +1618,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_088);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_088
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_088);
+#endif
   Plugin_ptr[x++] = &Plugin_088;
 #endif
 
@@ -1354,6 +1630,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_089);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_089
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_089);
+#endif
   Plugin_ptr[x++] = &Plugin_089;
 #endif
 
@@ -1363,6 +1642,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_090);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_090
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_090);
+#endif
   Plugin_ptr[x++] = &Plugin_090;
 #endif
 
@@ -1372,6 +1654,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_091);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_091
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_091);
+#endif
   Plugin_ptr[x++] = &Plugin_091;
 #endif
 
@@ -1381,6 +1666,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_092);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_092
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_092);
+#endif
   Plugin_ptr[x++] = &Plugin_092;
 #endif
 
@@ -1390,6 +1678,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_093);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_093
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_093);
+#endif
   Plugin_ptr[x++] = &Plugin_093;
 #endif
 
@@ -1399,6 +1690,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_094);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_094
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_094);
+#endif
   Plugin_ptr[x++] = &Plugin_094;
 #endif
 
@@ -1408,6 +1702,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_095);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_095
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_095);
+#endif
   Plugin_ptr[x++] = &Plugin_095;
 #endif
 
@@ -1417,6 +1714,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_096);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_096
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_096);
+#endif
   Plugin_ptr[x++] = &Plugin_096;
 #endif
 
@@ -1426,6 +1726,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_097);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_097
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_097);
+#endif
   Plugin_ptr[x++] = &Plugin_097;
 #endif
 
@@ -1435,6 +1738,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_098);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_098
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_098);
+#endif
   Plugin_ptr[x++] = &Plugin_098;
 #endif
 
@@ -1444,6 +1750,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_099);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_099
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_099);
+#endif
   Plugin_ptr[x++] = &Plugin_099;
 #endif
 
@@ -1453,6 +1762,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_100);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_100
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_100);
+#endif
   Plugin_ptr[x++] = &Plugin_100;
 #endif
 
@@ -1462,6 +1774,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_101);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_101
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_101);
+#endif
   Plugin_ptr[x++] = &Plugin_101;
 #endif
 
@@ -1471,6 +1786,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_102);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_102
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_102);
+#endif
   Plugin_ptr[x++] = &Plugin_102;
 #endif
 
@@ -1480,6 +1798,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_103);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_103
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_103);
+#endif
   Plugin_ptr[x++] = &Plugin_103;
 #endif
 
@@ -1489,6 +1810,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_104);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_104
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_104);
+#endif
   Plugin_ptr[x++] = &Plugin_104;
 #endif
 
@@ -1498,6 +1822,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_105);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_105
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_105);
+#endif
   Plugin_ptr[x++] = &Plugin_105;
 #endif
 
@@ -1507,6 +1834,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_106);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_106
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_106);
+#endif
   Plugin_ptr[x++] = &Plugin_106;
 #endif
 
@@ -1516,6 +1846,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_107);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_107
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_107);
+#endif
   Plugin_ptr[x++] = &Plugin_107;
 #endif
 
@@ -1525,6 +1858,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_108);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_108
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_108);
+#endif
   Plugin_ptr[x++] = &Plugin_108;
 #endif
 
@@ -1534,6 +1870,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_109);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_109
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_109);
+#endif
   Plugin_ptr[x++] = &Plugin_109;
 #endif
 
@@ -1543,6 +1882,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_110);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_110
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_110);
+#endif
   Plugin_ptr[x++] = &Plugin_110;
 #endif
 
@@ -1552,6 +1894,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_111);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_111
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_111);
+#endif
   Plugin_ptr[x++] = &Plugin_111;
 #endif
 
@@ -1561,6 +1906,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_112);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_112
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_112);
+#endif
   Plugin_ptr[x++] = &Plugin_112;
 #endif
 
@@ -1570,6 +1918,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_113);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_113
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_113);
+#endif
   Plugin_ptr[x++] = &Plugin_113;
 #endif
 
@@ -1579,6 +1930,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_114);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_114
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_114);
+#endif
   Plugin_ptr[x++] = &Plugin_114;
 #endif
 
@@ -1588,6 +1942,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_115);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_115
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_115);
+#endif
   Plugin_ptr[x++] = &Plugin_115;
 #endif
 
@@ -1597,6 +1954,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_116);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_116
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_116);
+#endif
   Plugin_ptr[x++] = &Plugin_116;
 #endif
 
@@ -1606,6 +1966,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_117);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_117
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_117);
+#endif
   Plugin_ptr[x++] = &Plugin_117;
 #endif
 
@@ -1615,6 +1978,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_118);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_118
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_118);
+#endif
   Plugin_ptr[x++] = &Plugin_118;
 #endif
 
@@ -1624,6 +1990,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_119);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_119
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_119);
+#endif
   Plugin_ptr[x++] = &Plugin_119;
 #endif
 
@@ -1633,6 +2002,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_120);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_120
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_120);
+#endif
   Plugin_ptr[x++] = &Plugin_120;
 #endif
 
@@ -1642,6 +2014,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_250);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_250
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_250);
+#endif
   Plugin_ptr[x++] = &Plugin_250;
 #endif
 
@@ -1651,6 +2026,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_251);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_251
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_251);
+#endif
   Plugin_ptr[x++] = &Plugin_251;
 #endif
 
@@ -1660,6 +2038,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_252);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_252
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_252);
+#endif
   Plugin_ptr[x++] = &Plugin_252;
 #endif
 
@@ -1669,6 +2050,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_253);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_253
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_253);
+#endif
   Plugin_ptr[x++] = &Plugin_253;
 #endif
 
@@ -1678,6 +2062,9 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_254);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_254
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_254);
+#endif
   Plugin_ptr[x++] = &Plugin_254;
 #endif
 
@@ -1687,9 +2074,15 @@ void PluginInit(void)
   Plugin_Description[x] = PSTR(PLUGIN_DESC_255);
 #endif
   Plugin_State[x] = P_Enabled;
+#ifdef PLUGIN_PULSES_255
+  PLUGIN_DECLARE_PULSES(x, PLUGIN_PULSES_255);
+#endif
   Plugin_ptr[x++] = &Plugin_255;
 #endif
 
+  RFLink::Plugin::refreshParametersFromConfig(false);
+  RFLink::Plugin::updateOrder();
+
   // Initialiseer alle plugins door aanroep met verwerkingsparameter PLUGIN_INIT
   PluginInitCall(0, 0);
 }
@@ -2273,24 +2666,401 @@ byte PluginTXInitCall(byte Function, char *str)
   return true;
 }
 /*********************************************************************************************\
- * With this function plugins are called that have Receive functionality. 
+ * Calling order of the receive plugins: table order unless adaptive or pinned order is enabled.
  \*********************************************************************************************/
-byte PluginRXCall(byte Function, const char *str)
+static byte pluginOrder[PLUGIN_MAX];           // plugin table indexes, in calling order
+static byte pluginRank[PLUGIN_MAX];            // position of each plugin in pluginOrder
+static byte pluginOrderCount = 0;
+static uint16_t pluginRecentMatches[PLUGIN_MAX]; // decaying count of decoded signals, for the adaptive order
+static byte matchesSinceReorder = 0;
+static volatile bool orderUpdateRequired = false;
+
+static unsigned long pluginLastDecodeTime[PLUGIN_MAX]; // millis() of the last signal decoded by each plugin
+static bool pluginDecodedOnce[PLUGIN_MAX];
+
+/*********************************************************************************************\
+ * Dispatch index: pulse counts are split into segments in which the same plugins are candidates.
+ * Each segment lists its candidates in calling order.
+ \*********************************************************************************************/
+#define PLUGIN_DISPATCH_MAX_SEGMENTS 160
+#define PLUGIN_DISPATCH_MAX_ENTRIES 1024
+
+static uint16_t dispatchSegmentStart[PLUGIN_DISPATCH_MAX_SEGMENTS];       // first pulse count of each segment, sorted
+static uint16_t dispatchSegmentOffset[PLUGIN_DISPATCH_MAX_SEGMENTS + 1];  // first entry of each segment in dispatchEntries
+static byte dispatchEntries[PLUGIN_DISPATCH_MAX_ENTRIES];                 // plugin table indexes
+static byte dispatchSegmentsCount = 0;                                    // 0 means no index, every plugin is called
+
+// ranges given by PluginSetPulseRange(), by plugin id as they may be set before PluginInit()
+#define PLUGIN_CONFIGURED_RANGES_MAX 2
+
+static struct
+{
+  byte pluginId;
+  PluginPulseRange range;
+} configuredRanges[PLUGIN_CONFIGURED_RANGES_MAX];
+static byte configuredRangesCount = 0;
+
+static const PluginPulseRange *findConfiguredRange(byte pluginId)
+{
+  for (byte i = 0; i < configuredRangesCount; i++)
+  {
+    if (configuredRanges[i].pluginId == pluginId)
+      return &configuredRanges[i].range;
+  }
+  return nullptr;
+}
+
+void PluginSetPulseRange(byte pluginId, uint16_t min, uint16_t max)
+{
+  byte i = 0;
+  while (i < configuredRangesCount && configuredRanges[i].pluginId != pluginId)
+    i++;
+  if (i >= PLUGIN_CONFIGURED_RANGES_MAX)
+  {
+    Serial.println(F("Too many plugins with configured pulse counts, the last one will be called for every signal"));
+    return;
+  }
+  if (i == configuredRangesCount)
+    configuredRangesCount++;
+
+  configuredRanges[i].pluginId = pluginId;
+  configuredRanges[i].range.min = min;
+  configuredRanges[i].range.max = max;
+  orderUpdateRequired = true;
+}
+
+bool PluginAcceptsPulseCount(byte x, uint16_t number)
+{
+  const PluginPulseRange *configured = findConfiguredRange(Plugin_id[x]);
+  if (configured != nullptr)
+    return number >= configured->min && number <= configured->max;
+
+  if (Plugin_PulseRanges[x] == nullptr)
+    return true;
+
+  for (byte i = 0; i < Plugin_PulseRangesCount[x]; i++)
+  {
+    PluginPulseRange range;
+    memcpy_P(&range, &Plugin_PulseRanges[x][i], sizeof(range));
+    if (number >= range.min && number <= range.max)
+      return true;
+  }
+  return false;
+}
+
+static bool addDispatchSegmentStart(uint32_t start)
+{
+  if (start > 0xFFFF)
+    return true; // past the highest possible pulse count
+
+  byte i = 0;
+  while (i < dispatchSegmentsCount && dispatchSegmentStart[i] < start)
+    i++;
+  if (i < dispatchSegmentsCount && dispatchSegmentStart[i] == start)
+    return true;
+  if (dispatchSegmentsCount >= PLUGIN_DISPATCH_MAX_SEGMENTS)
+    return false;
+
+  memmove(&dispatchSegmentStart[i + 1], &dispatchSegmentStart[i], (dispatchSegmentsCount - i) * sizeof(dispatchSegmentStart[0]));
+  dispatchSegmentStart[i] = start;
+  dispatchSegmentsCount++;
+  return true;
+}
+
+void PluginBuildDispatchIndex()
+{
+  dispatchSegmentsCount = 0;
+  bool success = addDispatchSegmentStart(0);
+
+  for (byte x = 0; x < PLUGIN_MAX && success; x++)
+  {
+    if (Plugin_id[x] == 0)
+      continue;
+
+    const PluginPulseRange *configured = findConfiguredRange(Plugin_id[x]);
+    if (configured != nullptr)
+    {
+      if (configured->min <= configured->max)
+        success = addDispatchSegmentStart(configured->min) && addDispatchSegmentStart((uint32_t)configured->max + 1);
+      continue;
+    }
+
+    if (Plugin_PulseRanges[x] == nullptr)
+      continue;
+
+    for (byte i = 0; i < Plugin_PulseRangesCount[x] && success; i++)
+    {
+      PluginPulseRange range;
+      memcpy_P(&range, &Plugin_PulseRanges[x][i], sizeof(range));
+      success = addDispatchSegmentStart(range.min) && addDispatchSegmentStart((uint32_t)range.max + 1);
+    }
+  }
+
+  uint16_t entriesCount = 0;
+  for (byte segment = 0; segment < dispatchSegmentsCount && success; segment++)
+  {
+    dispatchSegmentOffset[segment] = entriesCount;
+    for (byte rank = 0; rank < pluginOrderCount; rank++)
+    {
+      byte x = pluginOrder[rank];
+      if (!PluginAcceptsPulseCount(x, dispatchSegmentStart[segment]))
+        continue;
+      if (entriesCount >= PLUGIN_DISPATCH_MAX_ENTRIES)
+      {
+        success = false;
+        break;
+      }
+      dispatchEntries[entriesCount++] = x;
+    }
+  }
+
+  if (!success)
+  {
+    dispatchSegmentsCount = 0;
+    Serial.println(F("Plugins dispatch index is too large, all plugins will be called for every signal"));
+    return;
+  }
+
+  dispatchSegmentOffset[dispatchSegmentsCount] = entriesCount;
+}
+
+static byte findDispatchSegment(int number)
+{
+  if (number < 0)
+    number = 0;
+
+  // last segment starting at or before number
+  byte low = 0, high = dispatchSegmentsCount - 1;
+  while (low < high)
+  {
+    byte middle = (low + high + 1) / 2;
+    if (dispatchSegmentStart[middle] <= number)
+      low = middle;
+    else
+      high = middle - 1;
+  }
+  return low;
+}
+
+#ifndef RFLINK_PLUGIN_STATS_DISABLED
+namespace RFLink { namespace Plugin { namespace counters {
+  PluginStats stats[PLUGIN_MAX];
+}}}
+
+// first pulse count of each bucket
+static const uint16_t pluginStatsBucketsStart[PLUGIN_STATS_BUCKETS] PROGMEM = {0, 32, 64, 96, 128, 192, 256, 512};
+
+static byte pluginStatsBucket(int number)
+{
+  byte bucket = PLUGIN_STATS_BUCKETS - 1;
+  while (bucket > 0 && number < (int)pgm_read_word(&pluginStatsBucketsStart[bucket]))
+    bucket--;
+  return bucket;
+}
+#endif // RFLINK_PLUGIN_STATS_DISABLED
+
+static void recordMatch(byte x)
+{
+  if (!RFLink::Plugin::params::adaptive_order)
+    return;
+
+  if (pluginRecentMatches[x] < 0xFFFF)
+    pluginRecentMatches[x]++;
+  if (++matchesSinceReorder >= PLUGIN_REORDER_MATCHES)
+  {
+    matchesSinceReorder = 0;
+    orderUpdateRequired = true;
+  }
+}
+
+static bool callRXPlugin(byte x, byte Function, const char *str)
+{
+  SignalHash = x; // store plugin number
+
+#ifndef RFLINK_PLUGIN_STATS_DISABLED
+  int number = RawSignal.Number;
+  unsigned long start_us = micros();
+  bool success = Plugin_ptr[x](Function, str);
+  unsigned long duration_us = micros() - start_us;
+
+  auto &stats = RFLink::Plugin::counters::stats[x];
+  stats.calls++;
+  stats.totalTime_us += duration_us;
+  if (duration_us > stats.maxTime_us)
+    stats.maxTime_us = duration_us;
+  if (success)
+    stats.matches++;
+  else
+    stats.rejectedPulseCounts[pluginStatsBucket(number)]++;
+#else
+  bool success = Plugin_ptr[x](Function, str);
+#endif
+  RFLink::Signal::RepeatCache::pluginDone(success);
+
+  if (success)
+  {
+    DispatchResult.decodedBy = Plugin_id[x];
+    pluginLastDecodeTime[x] = millis();
+    pluginDecodedOnce[x] = true;
+    recordMatch(x);
+  }
+  return success;
+}
+
+bool PluginDecodedRecently(byte pluginId, unsigned long extraTime_ms)
 {
   for (byte x = 0; x < PLUGIN_MAX; x++)
   {
-    if ((Plugin_id[x] != 0) && (Plugin_State[x] >= P_Enabled))
+    if (Plugin_id[x] == pluginId && Plugin_ptr[x] != 0)
+      return pluginDecodedOnce[x] && (millis() - pluginLastDecodeTime[x] < RFLink::Signal::params::signal_repeat_time + extraTime_ms);
+  }
+  return false;
+}
+
+static bool dispatchFrame(byte Function, const char *str)
+{
+  if (dispatchSegmentsCount == 0)
+  {
+    for (byte rank = 0; rank < pluginOrderCount; rank++)
     {
-      SignalHash = x; // store plugin number
-      if (Plugin_ptr[x](Function, str))
+      byte x = pluginOrder[rank];
+      if (Plugin_State[x] >= P_Enabled)
       {
-        SignalHashPrevious = SignalHash; // store previous plugin number after success
-        return true;
+        if (callRXPlugin(x, Function, str))
+          return true;
       }
+      if (RawSignal.Number != FrameFeatures.Number)
+        computeFrameFeatures(RawSignal, FrameFeatures);
+    }
+    return false;
+  }
+
+  int number = RawSignal.Number;
+  byte segment = findDispatchSegment(number);
+  uint16_t i = dispatchSegmentOffset[segment];
+
+  while (i < dispatchSegmentOffset[segment + 1])
+  {
+    byte x = dispatchEntries[i++];
+    if (Plugin_State[x] >= P_Enabled)
+    {
+      if (callRXPlugin(x, Function, str))
+        return true;
+    }
+
+    if (RawSignal.Number != number)
+    {
+      // Some plugins (ie 001) rework the signal for the ones after them: carry on with the
+      // candidates of the new pulse count which come after this plugin in calling order
+      number = RawSignal.Number;
+      computeFrameFeatures(RawSignal, FrameFeatures);
+      segment = findDispatchSegment(number);
+      i = dispatchSegmentOffset[segment];
+      while (i < dispatchSegmentOffset[segment + 1] && pluginRank[dispatchEntries[i]] <= pluginRank[x])
+        i++;
     }
   }
   return false;
 }
+
+static int selectedEnds[2];   // packets moved to the front of Pulses[], a sub-frame then a packet cut by plugin 001
+static int selectedNumbers[2];
+static byte selectedCount = 0;
+
+static void reversePulses(int first, int last)
+{
+  while (first < last)
+  {
+    uint16_t pulse = RawSignal.Pulses[first];
+    RawSignal.Pulses[first++] = RawSignal.Pulses[last];
+    RawSignal.Pulses[last--] = pulse;
+  }
+}
+
+// Moves Pulses[start..end] in front of Pulses[1..start - 1], in place
+static void rotatePulses(int start, int end)
+{
+  reversePulses(1, start - 1);
+  reversePulses(start, end);
+  reversePulses(1, end);
+}
+
+void PluginSelectPulses(int start, int number)
+{
+  if (start > 1 && selectedCount < sizeof(selectedEnds) / sizeof(selectedEnds[0]))
+  {
+    selectedEnds[selectedCount] = start + number - 1;
+    selectedNumbers[selectedCount++] = number;
+    rotatePulses(start, start + number - 1);
+  }
+  RawSignal.Number = number;
+}
+
+// Undoes PluginSelectPulses(), latest first
+static void restorePulses(int number)
+{
+  while (selectedCount > 0)
+  {
+    selectedCount--;
+    rotatePulses(selectedNumbers[selectedCount] + 1, selectedEnds[selectedCount]);
+  }
+  RawSignal.Number = number;
+}
+
+/*********************************************************************************************\
+ * With this function plugins are called that have Receive functionality. 
+ * A frame holding several packets is first given whole to the plugins, then packet by packet,
+ * skipping the ones identical to a packet already tried. Each packet is moved to the front of
+ * RawSignal.Pulses[] while it is tried, RawSignal is left as received afterwards.
+ \*********************************************************************************************/
+byte PluginRXCall(byte Function, const char *str)
+{
+  if (orderUpdateRequired)
+    RFLink::Plugin::updateOrder();
+
+  DispatchResult.decodedBy = 0;
+  DispatchResult.routeHint = 0;
+
+  computeFrameFeatures(RawSignal, FrameFeatures);
+  indexSubFrames(RawSignal, FrameFeatures, SubFrames);
+
+  const int frameNumber = RawSignal.Number;
+  bool decoded = dispatchFrame(Function, str);
+  restorePulses(frameNumber);
+
+  int start = 1;
+  for (byte s = 0; s < SubFrames.count && !decoded; s++)
+  {
+    const int end = SubFrames.ends[s];
+    const int number = end - start + 1;
+
+    bool alreadyTried = false;
+    int previousStart = 1;
+    for (byte p = 0; p < s && !alreadyTried; p++)
+    {
+      alreadyTried = SubFrames.signatures[p] == SubFrames.signatures[s] && SubFrames.ends[p] - previousStart + 1 == number;
+      previousStart = SubFrames.ends[p] + 1;
+    }
+
+    if (!alreadyTried)
+    {
+      PluginSelectPulses(start, number);
+      DispatchResult.routeHint = 0;
+      computeFrameFeatures(RawSignal, FrameFeatures);
+      if (dispatchFrame(Function, str))
+      {
+        RFLink::Signal::counters::subFramesDecodedCount++;
+        decoded = true;
+      }
+      restorePulses(frameNumber);
+    }
+    start = end + 1;
+  }
+
+  if (FrameFeatures.Number != RawSignal.Number)
+    computeFrameFeatures(RawSignal, FrameFeatures);
+  return decoded;
+}
 /*********************************************************************************************\
  * With this function plugins are called that have Transmit functionality. 
  \*********************************************************************************************/
@@ -2310,4 +3080,267 @@ byte PluginTXCall(byte Function, const char *str)
   }
   return false;
 }
-/*********************************************************************************************/
\ No newline at end of file
+/*********************************************************************************************/
+
+namespace RFLink
+{
+  namespace Plugin
+  {
+    namespace commands
+    {
+      const char order[] PROGMEM = "order";
+      #ifndef RFLINK_PLUGIN_STATS_DISABLED
+      const char stats[] PROGMEM = "stats";
+      const char resetStats[] PROGMEM = "resetStats";
+      #endif
+    }
+
+    namespace params
+    {
+      bool adaptive_order = false;
+      String pinned_order;
+    }
+
+    // All json variable names
+    const char json_name_adaptive_order[] = "adaptive_plugin_order";
+    const char json_name_pinned_order[] = "pinned_plugin_order";
+
+    Config::ConfigItem configItems[] = {
+        Config::ConfigItem(json_name_adaptive_order, Config::SectionId::Signal_id, false, paramsUpdatedCallback),
+        Config::ConfigItem(json_name_pinned_order, Config::SectionId::Signal_id, "", paramsUpdatedCallback),
+        Config::ConfigItem()};
+
+    void paramsUpdatedCallback()
+    {
+      refreshParametersFromConfig();
+    }
+
+    void refreshParametersFromConfig(bool triggerChanges)
+    {
+      Config::ConfigItem *item;
+      bool changesDetected = false;
+
+      item = Config::findConfigItem(json_name_adaptive_order, Config::SectionId::Signal_id);
+      if (item->getBoolValue() != params::adaptive_order)
+      {
+        changesDetected = true;
+        params::adaptive_order = item->getBoolValue();
+      }
+
+      item = Config::findConfigItem(json_name_pinned_order, Config::SectionId::Signal_id);
+      if (params::pinned_order != item->getCharValue())
+      {
+        changesDetected = true;
+        params::pinned_order = item->getCharValue();
+      }
+
+      // Applying changes will happen at next PluginRXCall()
+      if (triggerChanges && changesDetected)
+      {
+        Serial.println(F("Plugins parameters have changed."));
+        orderUpdateRequired = true;
+      }
+    }
+
+    static bool isPinnedFirst(byte x)
+    {
+      return Plugin_id[x] == PLUGIN_ORDER_FIRST_ID;
+    }
+
+    static bool isPinnedLast(byte x)
+    {
+      return Plugin_id[x] >= PLUGIN_ORDER_LAST_MIN_ID;
+    }
+
+    static void appendToOrder(byte x)
+    {
+      pluginRank[x] = pluginOrderCount;
+      pluginOrder[pluginOrderCount++] = x;
+    }
+
+    void updateOrder()
+    {
+      const bool pinned = params::pinned_order.length() > 0;
+      const bool adaptive = params::adaptive_order && !pinned;
+
+      orderUpdateRequired = false;
+      pluginOrderCount = 0;
+      memset(pluginRank, 0xFF, sizeof(pluginRank));
+
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+      {
+        if (Plugin_id[x] != 0 && isPinnedFirst(x))
+          appendToOrder(x);
+      }
+
+      if (pinned)
+      {
+        const char *cursor = params::pinned_order.c_str();
+        while (*cursor != 0)
+        {
+          char *end;
+          long id = strtol(cursor, &end, 10);
+          if (end == cursor)
+          {
+            cursor++; // separator
+            continue;
+          }
+          cursor = end;
+
+          for (byte x = 0; x < PLUGIN_MAX; x++)
+          {
+            if (Plugin_id[x] == id && pluginRank[x] == 0xFF && !isPinnedLast(x))
+            {
+              appendToOrder(x);
+              break;
+            }
+          }
+        }
+      }
+
+      byte firstUnsorted = pluginOrderCount;
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+      {
+        if (Plugin_id[x] == 0 || pluginRank[x] != 0xFF || isPinnedLast(x))
+          continue;
+
+        // insertion sort, plugins with the same score keep their table order
+        byte position = pluginOrderCount;
+        if (adaptive)
+        {
+          while (position > firstUnsorted && pluginRecentMatches[pluginOrder[position - 1]] < pluginRecentMatches[x])
+          {
+            pluginOrder[position] = pluginOrder[position - 1];
+            position--;
+          }
+        }
+        pluginOrder[position] = x;
+        pluginOrderCount++;
+      }
+
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+      {
+        if (Plugin_id[x] != 0 && isPinnedLast(x))
+          pluginOrder[pluginOrderCount++] = x;
+      }
+
+      for (byte rank = 0; rank < pluginOrderCount; rank++)
+        pluginRank[pluginOrder[rank]] = rank;
+
+      if (adaptive)
+      {
+        // older matches weigh less at every update
+        for (byte x = 0; x < PLUGIN_MAX; x++)
+          pluginRecentMatches[x] /= 2;
+      }
+
+      PluginBuildDispatchIndex();
+    }
+
+#ifndef RFLINK_PLUGIN_STATS_DISABLED
+
+    void resetStats()
+    {
+      memset(counters::stats, 0, sizeof(counters::stats));
+    }
+
+    size_t getStatusJsonSize()
+    {
+      size_t activeCount = 0;
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+      {
+        if (counters::stats[x].calls > 0)
+          activeCount++;
+      }
+      return JSON_ARRAY_SIZE(activeCount) + activeCount * (JSON_OBJECT_SIZE(6) + JSON_ARRAY_SIZE(PLUGIN_STATS_BUCKETS));
+    }
+
+    void getStatusJsonString(JsonObject &output)
+    {
+      // keys are not F() strings on purpose: they would be copied in the document for each plugin
+      auto &&plugins = output.createNestedArray("plugins");
+
+      for (byte x = 0; x < PLUGIN_MAX; x++)
+      {
+        const auto &stats = counters::stats[x];
+        if (stats.calls == 0)
+          continue;
+
+        auto &&plugin = plugins.createNestedObject();
+        plugin["id"] = Plugin_id[x];
+        plugin["calls"] = stats.calls;
+        plugin["matches"] = stats.matches;
+        plugin["time_us"] = stats.totalTime_us;
+        plugin["max_time_us"] = stats.maxTime_us;
+        auto &&rejected = plugin.createNestedArray("rejected_pulses");
+        for (byte bucket = 0; bucket < PLUGIN_STATS_BUCKETS; bucket++)
+          rejected.add(stats.rejectedPulseCounts[bucket]);
+      }
+    }
+
+#endif // RFLINK_PLUGIN_STATS_DISABLED
+
+    void executeCliCommand(char *cmd)
+    {
+      char *commaIndex = strchr(cmd, ';');
+
+      if (commaIndex == nullptr)
+      {
+        Serial.println(F("Error : failed to find ending ';' for the command"));
+        return;
+      }
+
+      int commandSize = commaIndex - cmd;
+
+      if (strncasecmp_P(cmd, commands::order, commandSize) == 0)
+      {
+        // can be pasted as is in pinned_plugin_order
+        sendRawPrint(PSTR("30;plugins;order;"));
+        for (byte rank = 0; rank < pluginOrderCount; rank++)
+        {
+          if (rank > 0)
+            sendRawPrint(',');
+          sendRawPrint((unsigned int)Plugin_id[pluginOrder[rank]]);
+        }
+        sendRawPrint(PSTR(";"), true);
+      }
+      #ifndef RFLINK_PLUGIN_STATS_DISABLED
+      else if (strncasecmp_P(cmd, commands::resetStats, commandSize) == 0)
+      {
+        resetStats();
+        sendRawPrint(PSTR("30;plugins;stats reset;"), true);
+      }
+      else if (strncasecmp_P(cmd, commands::stats, commandSize) == 0)
+      {
+        sendRawPrint(PSTR("30;plugins;stats;buckets="));
+        for (byte bucket = 0; bucket < PLUGIN_STATS_BUCKETS; bucket++)
+        {
+          if (bucket > 0)
+            sendRawPrint(',');
+          sendRawPrint((unsigned int)pgm_read_word(&pluginStatsBucketsStart[bucket]));
+        }
+        sendRawPrint(PSTR(";"), true);
+
+        for (byte x = 0; x < PLUGIN_MAX; x++)
+        {
+          const auto &stats = counters::stats[x];
+          if (stats.calls == 0)
+            continue;
+
+          int len = snprintf_P(printBuf, sizeof(printBuf), PSTR("30;plugins;stats;id=%03u;calls=%lu;matches=%lu;time_us=%lu;max_time_us=%lu;rejected="),
+                               Plugin_id[x], stats.calls, stats.matches, stats.totalTime_us, stats.maxTime_us);
+          for (byte bucket = 0; bucket < PLUGIN_STATS_BUCKETS && len < (int)sizeof(printBuf); bucket++)
+            len += snprintf_P(printBuf + len, sizeof(printBuf) - len, bucket > 0 ? PSTR(",%lu") : PSTR("%lu"), stats.rejectedPulseCounts[bucket]);
+          if (len < (int)sizeof(printBuf))
+            snprintf_P(printBuf + len, sizeof(printBuf) - len, PSTR(";"));
+          sendRawPrint(printBuf, true);
+        }
+      }
+      #endif // RFLINK_PLUGIN_STATS_DISABLED
+      else
+      {
+        Serial.printf_P(PSTR("Error : unknown command '%s'\r\n"), cmd);
+      }
+    }
+  }
+}
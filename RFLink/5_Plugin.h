@@ -9,10 +9,16 @@
 #define Plugin_h
 
 #include <Arduino.h>
+#include <ArduinoJson.h>
+#include "11_Config.h"
 
 #define PLUGIN_MAX 84    // Maximum number of Receive plugins
 #define PLUGIN_TX_MAX 84 // Maximum number of Transmit plugins
 
+#define PLUGIN_ORDER_FIRST_ID 1      // Plugin 001 prepares signals for the other plugins, it is always called first
+#define PLUGIN_ORDER_LAST_MIN_ID 250 // Debug and catch-all plugins (250+) are always called last
+#define PLUGIN_REORDER_MATCHES 32    // Adaptive order is recomputed every time this many signals have been decoded
+
 enum PState
 {
     P_Forbidden,
@@ -28,6 +34,56 @@ extern byte Plugin_State[PLUGIN_MAX];
 extern const char* Plugin_Description[PLUGIN_MAX];
 #endif
 
+/**
+ * Receive plugins declare the pulse counts (RawSignal.Number) they can decode with a
+ * PLUGIN_PULSES_xxx define next to their other constants, for example:
+ *   #define PLUGIN_PULSES_004 {132, 132}, {148, 148}
+ * PluginRXCall() then only calls the plugins which accept the received pulse count.
+ * Plugins without such a define are called for any pulse count, unless their pulse counts come from
+ * the configuration and they give them to PluginSetPulseRange() (see Flex).
+ * */
+struct PluginPulseRange
+{
+    uint16_t min;
+    uint16_t max;
+};
+
+extern const PluginPulseRange *Plugin_PulseRanges[PLUGIN_MAX]; // stored in PROGMEM
+extern byte Plugin_PulseRangesCount[PLUGIN_MAX];
+
+/**
+ * @return true if plugin at index x is called for frames of number pulses
+ * */
+bool PluginAcceptsPulseCount(byte x, uint16_t number);
+
+/**
+ * Replaces the PLUGIN_PULSES_xxx of plugin pluginId with min..max, none if min > max.
+ * The dispatch index is built again by the next PluginRXCall().
+ * */
+void PluginSetPulseRange(byte pluginId, uint16_t min, uint16_t max);
+
+/**
+ * Outcome of PluginRXCall() for the current frame. Receive plugins only read RawSignal: a plugin
+ * reports a decoded frame with its return value, and a plugin which recognises a frame meant for
+ * another one sets routeHint to that plugin id. The frame is still intact after decoding, so that
+ * it can also be archived or mirrored raw.
+ * Plugin 001 is the only exception: it cuts a packet out of the bursts of 036 and 037, which have
+ * no gap between repeats, with PluginSelectPulses().
+ * */
+struct PluginDispatchResult
+{
+    byte decodedBy; // id of the plugin which decoded the frame, 0 if none
+    byte routeHint; // id of the plugin the frame is meant for, 0 if none
+};
+
+extern PluginDispatchResult DispatchResult;
+
+/**
+ * Makes RawSignal.Pulses[start..start + number - 1] the frame given to the next plugins, by moving
+ * these pulses to the front in place. PluginRXCall() puts them back before it returns.
+ * */
+void PluginSelectPulses(int start, int number);
+
 extern boolean (*PluginTX_ptr[PLUGIN_TX_MAX])(byte, const char *); // Transmit plugins
 extern byte PluginTX_id[PLUGIN_TX_MAX];
 extern byte PluginTX_State[PLUGIN_TX_MAX];
@@ -43,6 +99,52 @@ void PluginTXInit();
 byte PluginInitCall(byte Function, char *str);
 byte PluginTXInitCall(byte Function, char *str);
 byte PluginRXCall(byte Function, const char *str);
+void PluginBuildDispatchIndex();
 byte PluginTXCall(byte Function, const char *str);
+/**
+ * For rules across protocols, eg. a KAKU frame following a HomeEasy one is the same button press.
+ * @return true if plugin 'pluginId' decoded a signal less than signal_repeat_time + extraTime_ms ago
+ * */
+bool PluginDecodedRecently(byte pluginId, unsigned long extraTime_ms = 0);
+
+namespace RFLink {
+    namespace Plugin {
+
+        namespace params {
+            extern bool adaptive_order;  // call the plugins which decoded the most signals recently first
+            extern String pinned_order;  // comma separated plugin ids called first, in this order. Disables adaptive order
+        }
+
+        extern Config::ConfigItem configItems[];
+
+        void paramsUpdatedCallback();
+        void refreshParametersFromConfig(bool triggerChanges=true);
+        void updateOrder();
+
+        void executeCliCommand(char *cmd);
+
+#ifndef RFLINK_PLUGIN_STATS_DISABLED
+        #define PLUGIN_STATS_BUCKETS 8 // pulse count buckets of the rejected frames histogram
+
+        namespace counters {
+            struct PluginStats
+            {
+                unsigned long calls;
+                unsigned long matches;
+                unsigned long totalTime_us;
+                unsigned long maxTime_us;
+                unsigned long rejectedPulseCounts[PLUGIN_STATS_BUCKETS];
+            };
+
+            extern PluginStats stats[PLUGIN_MAX]; // same index as Plugin_id
+        }
+
+        void resetStats();
+        size_t getStatusJsonSize();
+        void getStatusJsonString(JsonObject &output);
+#endif // RFLINK_PLUGIN_STATS_DISABLED
+
+    }
+}
 
 #endif
\ No newline at end of file
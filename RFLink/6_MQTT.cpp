@@ -44,8 +44,29 @@ BearSSL::X509List *sslTrustedAnchors  = nullptr;
 // MQTT_SOCKET_TIMEOUT: socket timeout interval in Seconds
 #define MQTT_SOCKET_TIMEOUT 60
 
+// MQTT_CONNECT_TIMEOUT_MS: longest the main loop may be blocked by the TCP connection and TLS handshake
+#define MQTT_CONNECT_TIMEOUT_MS 3000
+
+// MQTT_HANDSHAKE_TIMEOUT: longest wait for the broker to accept the connection, in Seconds
+#define MQTT_HANDSHAKE_TIMEOUT 3
+
+// MQTT_BACKOFF_MIN_MS, MQTT_BACKOFF_MAX_MS: delay before the next connection attempt, doubled after each failure
+#define MQTT_BACKOFF_MIN_MS 2000
+#define MQTT_BACKOFF_MAX_MS 300000
+
+// MQTT_JSON_BUFFER_SIZE: decoded events published as JSON are longer than their text
+#define MQTT_JSON_BUFFER_SIZE 256
+
+// MQTT_CONNECT_TASK_ENABLED: on ESP32 a connection attempt runs in its own task, the main loop only polls it.
+// ESP8266 has no tasks, every step blocks the main loop for its own timeout at most.
+#if defined(ESP32) && !defined(MQTT_CONNECT_TASK_DISABLED)
+#define MQTT_CONNECT_TASK_ENABLED
+#define MQTT_CONNECT_TASK_STACK_SIZE 8192 // TLS handshake
+#define MQTT_CONNECT_TASK_PRIORITY 1
+#define MQTT_CONNECT_TASK_CORE 1          // with the main loop, the Signal task has core 0
+#endif
+
 #include <PubSubClient.h>
-boolean bResub; // uplink reSubscribe after setup only
 
 // Update these with values suitable for your network.
 
@@ -65,15 +86,56 @@ namespace RFLink { namespace Mqtt {
     bool lwt_enabled;
     String topic_lwt;
 
+    bool json_enabled;
+    bool record_enabled;
+
     bool ssl_enabled;
     bool ssl_insecure;
     String ca_cert;
   }
 
+  /**
+   * Connecting is split in steps:
+   * Waiting -> Connecting (TCP connection and TLS handshake) -> Handshaking (MQTT CONNECT) -> Subscribing -> Connected
+   * With MQTT_CONNECT_TASK_ENABLED the three steps run in a task and the main loop stays in Connecting until
+   * it is done. Otherwise each checkMQTTloop() call runs one step, which blocks for its own timeout at most.
+   * Any failure goes back to Waiting for the backoff delay.
+   * */
+  enum ConnectionStates {
+    Waiting,     // for vars::nextAttempt_ms
+    Connecting,  // opens the connection to the broker
+    Handshaking, // connection is open, the broker has to accept us
+    Subscribing,
+    Connected,
+  };
+
+  static const char *connectionStateNames[] = {"waiting", "connecting", "handshaking", "subscribing", "connected"};
+
   namespace vars {
     String ca_cert_content;
     String lastError;
     bool disabledBecauseOfError = false;
+
+    ConnectionStates state = Waiting;
+    unsigned long nextAttempt_ms = 0;
+    unsigned long backoff_ms = MQTT_BACKOFF_MIN_MS;
+    unsigned long attemptStart_ms = 0;
+    unsigned long lastLoop_ms = 0;
+
+    #ifdef MQTT_CONNECT_TASK_ENABLED
+    volatile bool taskRunning = false;
+    volatile bool taskDone = false;                      // set last by the task, taskStep and taskSuccess are valid
+    volatile ConnectionStates taskStep = Connecting;     // step the task stopped at
+    volatile bool taskSuccess = false;
+    #endif
+  }
+
+  namespace counters {
+    unsigned long int connectAttemptsCount = 0;
+    unsigned long int connectFailuresCount = 0;
+    unsigned long int lastConnectLatency_ms = 0;
+    unsigned long int maxBlocked_ms = 0;
+    unsigned long int totalBlocked_ms = 0;
   }
 
 // All json variable names
@@ -90,6 +152,9 @@ const char json_name_topic_out[] = "topic_out";
 const char json_name_lwt_enabled[] = "lwt_enabled";
 const char json_name_topic_lwt[] = "topic_lwt";
 
+const char json_name_json_enabled[] = "json_enabled";
+const char json_name_record_enabled[] = "record_enabled";
+
 #ifndef RFLINK_MQTT_CLIENT_SSL_DISABLED
 const char json_name_ssl_enabled[] = "ssl_enabled";
 const char json_name_ssl_insecure[] = "ssl_insecure";
@@ -98,7 +163,6 @@ const char *mqtt_ca_cert_filename = "/mqtt_ca_cert.pem";
 #endif
 // end of json variable names
 
-struct timeval lastMqttConnectionAttemptTime;
 bool paramsHaveChanged = true; 
 
 Config::ConfigItem configItems[] =  {
@@ -115,6 +179,9 @@ Config::ConfigItem configItems[] =  {
   Config::ConfigItem(json_name_lwt_enabled, Config::SectionId::MQTT_id, RFLink_default_MQTT_LWT, paramsUpdatedCallback),
   Config::ConfigItem(json_name_topic_lwt,   Config::SectionId::MQTT_id, MQTT_TOPIC_LWT, paramsUpdatedCallback),
 
+  Config::ConfigItem(json_name_json_enabled, Config::SectionId::MQTT_id, false, paramsUpdatedCallback),
+  Config::ConfigItem(json_name_record_enabled, Config::SectionId::MQTT_id, false, paramsUpdatedCallback),
+
   #ifndef RFLINK_MQTT_CLIENT_SSL_DISABLED
   Config::ConfigItem(json_name_ssl_enabled, Config::SectionId::MQTT_id, RFLink_default_MQTT_SSL_ENABLED, paramsUpdatedCallback),
   Config::ConfigItem(json_name_ssl_insecure,Config::SectionId::MQTT_id, true, paramsUpdatedCallback),
@@ -197,6 +264,18 @@ void refreshParametersFromConfig(bool triggerChanges) {
       params::topic_lwt = item->getCharValue();
     }
 
+    item = Config::findConfigItem(json_name_json_enabled, Config::SectionId::MQTT_id);
+    if( item->getBoolValue() != params::json_enabled) {
+      changesDetected = true;
+      params::json_enabled = item->getBoolValue();
+    }
+
+    item = Config::findConfigItem(json_name_record_enabled, Config::SectionId::MQTT_id);
+    if( item->getBoolValue() != params::record_enabled) {
+      changesDetected = true;
+      params::record_enabled = item->getBoolValue();
+    }
+
     #ifndef RFLINK_MQTT_CLIENT_SSL_DISABLED
 
     item = Config::findConfigItem(json_name_ssl_enabled, Config::SectionId::MQTT_id);
@@ -223,18 +302,16 @@ void refreshParametersFromConfig(bool triggerChanges) {
 
 void setup_MQTT()
 {
-  lastMqttConnectionAttemptTime.tv_sec = 0;
-
   refreshParametersFromConfig(false);
 
   MQTTClient.setKeepAlive(MQTT_KEEPALIVE);
+  MQTTClient.setSocketTimeout(MQTT_HANDSHAKE_TIMEOUT);
 
   if (params::port == 0)
     params::port = 1883;
 
   MQTTClient.setCallback(callback);
 
-  bResub = true;
   paramsHaveChanged = true; // force parameters to be applied at next loop
 }
 
@@ -245,101 +322,264 @@ void callback(char *topic, byte *payload, unsigned int length)
 }
 
 
-void reconnect(int retryCount, bool force)
+/**
+ * Main loop time spent waiting for the broker: connection steps without MQTT_CONNECT_TASK_ENABLED,
+ * publishing and MQTTClient.loop()
+ * */
+static void noteBlocked(unsigned long start_ms)
 {
-  if(!params::enabled)
-    return;
+  unsigned long blocked_ms = millis() - start_ms;
+  counters::totalBlocked_ms += blocked_ms;
+  if (blocked_ms > counters::maxBlocked_ms)
+    counters::maxBlocked_ms = blocked_ms;
+}
 
-  if(paramsHaveChanged)
-    return;
+static void closeConnection()
+{
+  if (MQTTClient.connected())
+    MQTTClient.disconnect();
+  WIFIClient.stop();
+  #ifndef RFLINK_MQTT_CLIENT_SSL_DISABLED
+  if (WIFIClientSecure != nullptr)
+    WIFIClientSecure->stop();
+  #endif
+}
 
-  if(!Wifi::ntpIsSynchronized() && params::ssl_enabled && !params::ssl_insecure) // secured SSL is not possible without NTP
-    return;
+static void scheduleRetry()
+{
+  closeConnection();
+  counters::connectFailuresCount++;
+
+  vars::state = Waiting;
+  vars::nextAttempt_ms = millis() + vars::backoff_ms;
+  Serial.print(F("MQTT next attempt in "));
+  Serial.print(vars::backoff_ms / 1000);
+  Serial.println(F("s"));
+
+  vars::backoff_ms *= 2;
+  if (vars::backoff_ms > MQTT_BACKOFF_MAX_MS)
+    vars::backoff_ms = MQTT_BACKOFF_MAX_MS;
+}
 
-  struct timeval currentTime;
-  gettimeofday(&currentTime, nullptr);
+/**
+ * Opens the TCP connection, and does the TLS handshake if ssl_enabled, within MQTT_CONNECT_TIMEOUT_MS
+ * */
+static bool connectTransport()
+{
+  const char *server = params::server.c_str();
 
-  if(!force) {
-    if(currentTime.tv_sec- lastMqttConnectionAttemptTime.tv_sec < 30) {
-      return;
-    }
+  #ifndef RFLINK_MQTT_CLIENT_SSL_DISABLED
+  if (params::ssl_enabled) {
+    #ifdef ESP32
+    WIFIClientSecure->setHandshakeTimeout(MQTT_CONNECT_TIMEOUT_MS / 1000);
+    return WIFIClientSecure->connect(server, params::port, MQTT_CONNECT_TIMEOUT_MS);
+    #else
+    WIFIClientSecure->setTimeout(MQTT_CONNECT_TIMEOUT_MS);
+    return WIFIClientSecure->connect(server, params::port);
+    #endif
   }
+  #endif
 
-  int retryLeft = retryCount;
-  bResub = true;
+  #ifdef ESP32
+  return WIFIClient.connect(server, params::port, MQTT_CONNECT_TIMEOUT_MS);
+  #else
+  WIFIClient.setTimeout(MQTT_CONNECT_TIMEOUT_MS);
+  return WIFIClient.connect(server, params::port);
+  #endif
+}
 
-  if(force && MQTTClient.connected()) {
-    MQTTClient.disconnect();
+/**
+ * Transport is already connected, PubSubClient only sends CONNECT and waits MQTT_HANDSHAKE_TIMEOUT for the answer
+ * */
+static bool sendConnect()
+{
+  if(params::lwt_enabled) {
+    #ifdef ESP32
+    return MQTTClient.connect(params::id.c_str(), params::user.c_str(), params::password.c_str(), (params::topic_lwt).c_str(), 2, true, PSTR("Offline"));
+    #elif defined(ESP8266)
+    return MQTTClient.connect(params::id.c_str(), params::user.c_str(), params::password.c_str(), (params::topic_lwt).c_str(), 2, true, "Offline");
+    #endif // ESP
   }
+  return MQTTClient.connect(params::id.c_str(), params::user.c_str(), params::password.c_str());
+}
 
+static bool subscribe()
+{
+  bool success = MQTTClient.subscribe(params::topic_in.c_str());
+  if (success && params::lwt_enabled) {
+    #ifdef ESP32
+    success = MQTTClient.publish((params::topic_lwt).c_str(), PSTR("Online"), true);
+    #elif ESP8266
+    success = MQTTClient.publish((params::topic_lwt).c_str(), "Online", true);
+    #endif // ESP
+  }
+  return success;
+}
 
-  while (!MQTTClient.connected() && (retryCount<=0 || retryLeft>0))
-  {
-    retryLeft--;
-    lastMqttConnectionAttemptTime.tv_sec = currentTime.tv_sec;
+static bool runStep(ConnectionStates step)
+{
+  switch (step) {
+  case Connecting:
+    return connectTransport();
+  case Handshaking:
+    return sendConnect();
+  case Subscribing:
+    return subscribe();
+  default:
+    return false;
+  }
+}
 
-    Serial.print(F("Trying to connect to MQTT Server '"));
-    Serial.print(params::server.c_str());
-    Serial.print(F("' ... "));
+/**
+ * Reports the outcome of step, then moves to the next state or waits for the next attempt
+ * */
+static void completeStep(ConnectionStates step, bool success)
+{
+  if (!success) {
+    switch (step) {
+    case Connecting:
+      Serial.println(F("MQTT Server is not reachable"));
+      break;
+    case Handshaking:
+      Serial.print(F("MQTT connection failed - rc="));
+      Serial.println(MQTTClient.state());
+      break;
+    default:
+      Serial.println(F("MQTT subscription failed"));
+      break;
+    }
+    scheduleRetry();
+    return;
+  }
+
+  switch (step) {
+  case Connecting:
+    vars::state = Handshaking;
+    return;
+  case Handshaking:
+    Serial.println(F("MQTT connection established"));
+    Serial.print(F("MQTT ID :\t\t"));
+    Serial.println(params::id.c_str());
+    Serial.print(F("MQTT Username :\t\t"));
+    Serial.println(params::user.c_str());
+    vars::state = Subscribing;
+    return;
+  default:
+    counters::lastConnectLatency_ms = millis() - vars::attemptStart_ms;
+    vars::backoff_ms = MQTT_BACKOFF_MIN_MS;
+    vars::state = Connected;
+    vars::lastLoop_ms = millis();
+    return;
+  }
+}
 
-    bool connectOK;
+#ifdef MQTT_CONNECT_TASK_ENABLED
+/**
+ * Runs the steps of one attempt, the main loop must not touch the clients until taskDone
+ * */
+static void connectTask(void *)
+{
+  ConnectionStates step = Connecting;
+  bool success;
+  while ((success = runStep(step)) && step != Subscribing)
+    step = (ConnectionStates)(step + 1);
+
+  vars::taskStep = step;
+  vars::taskSuccess = success;
+  vars::taskDone = true;
+  vTaskDelete(nullptr);
+}
 
-    if(params::lwt_enabled) {
-      #ifdef ESP32
-      connectOK = MQTTClient.connect(params::id.c_str(), params::user.c_str(), params::password.c_str(), (params::topic_lwt).c_str(), 2, true, PSTR("Offline"));
-      #elif defined(ESP8266)
-      connectOK = MQTTClient.connect(params::id.c_str(), params::user.c_str(), params::password.c_str(), (params::topic_lwt).c_str(), 2, true, "Offline");
-      #endif // ESP
+/**
+ * @return true while the connect task has the clients
+ * */
+static bool connectTaskBusy()
+{
+  if (!vars::taskRunning)
+    return false;
+  if (!vars::taskDone)
+    return true;
+
+  // replay the steps in the main loop, as if they had been run one by one
+  vars::taskRunning = false;
+  for (int step = Connecting; step <= vars::taskStep; step++)
+    completeStep((ConnectionStates)step, step < vars::taskStep || vars::taskSuccess);
+  return false;
+}
+#else
+static inline bool connectTaskBusy()
+{
+  return false;
+}
+#endif
 
-    } else {
-      connectOK = MQTTClient.connect(params::id.c_str(), params::user.c_str(), params::password.c_str());
-    }
+void reconnect()
+{
+  if(!params::enabled)
+    return;
 
-    if(connectOK)
-    {
-      Serial.println(F("Established"));
-      Serial.print(F("MQTT ID :\t\t"));
-      Serial.println(params::id.c_str());
-      Serial.print(F("MQTT Username :\t\t"));
-      Serial.println(params::user.c_str());
-      if(params::lwt_enabled) {
-        #ifdef ESP32
-              MQTTClient.publish((params::topic_lwt).c_str(), PSTR("Online"), true);
-        #elif ESP8266
-              MQTTClient.publish((params::topic_lwt).c_str(), "Online", true);
-        #endif // ESP
-      }
-    }
-    else
-    {
-      Serial.print(F("Failed - rc="));
-      Serial.println(MQTTClient.state());
-    }
-  }
+  if(paramsHaveChanged)
+    return;
+
+  if(connectTaskBusy()) // an attempt is already going on
+    return;
+
+  closeConnection();
+  vars::state = Waiting;
+  vars::backoff_ms = MQTT_BACKOFF_MIN_MS;
+  vars::nextAttempt_ms = millis();
 }
 
-void publishMsg()
+bool needsEventText()
+{
+  return params::enabled && !params::json_enabled && !params::record_enabled && vars::state == Connected && MQTTClient.connected();
+}
+
+void publishEvent(const EventRecord &event, const char *text)
 {
   if(!params::enabled)
     return;
 
-  if(!MQTTClient.connected())
+  if(vars::state != Connected || !MQTTClient.connected()) // the connect task may have the client
     return;
 
+  unsigned long start_ms = millis();
+
   static boolean MQTT_RETAINED = MQTT_RETAINED_0;
 
-  if (!MQTTClient.connected())
-    reconnect(1);
-  MQTTClient.publish(params::topic_out.c_str(), pbuffer, MQTT_RETAINED);
+  if (params::record_enabled) {
+    // sequence, truncated flag, then the fields as recorded, see EventRecord
+    static uint8_t record[2 + EVENT_RECORD_SIZE];
+    record[0] = event.sequence;
+    record[1] = event.truncated;
+    memcpy(record + 2, event.data, event.size);
+    MQTTClient.publish(params::topic_out.c_str(), record, 2 + event.size, MQTT_RETAINED);
+    noteBlocked(start_ms);
+    return;
+  }
+
+  if (params::json_enabled) {
+    static char json[MQTT_JSON_BUFFER_SIZE];
+    static OutputBuilder jsonBuilder(json, sizeof(json), 2);
+    json[0] = 0;
+    formatEventJson(event, jsonBuilder);
+    text = json;
+  }
+  MQTTClient.publish(params::topic_out.c_str(), text, MQTT_RETAINED);
+  noteBlocked(start_ms);
 }
 
 void checkMQTTloop()
 {
   if(!RFLink::Wifi::clientNetworkIsUp()) return;
 
+  if(connectTaskBusy()) // parameters and clients can only change once it is done
+    return;
+
   if(paramsHaveChanged) {
     paramsHaveChanged = false;
     vars::disabledBecauseOfError = false;
+    vars::state = Waiting;
 
     Serial.println(F("MQTT parameters have changed, first disconnecting..."));
 
@@ -422,8 +662,7 @@ void checkMQTTloop()
     }
 
     MQTTClient.setServer(params::server.c_str(), params::port);
-    reconnect(1, true);
-    gettimeofday(&lastMqttConnectionAttemptTime, nullptr);
+    reconnect();
     return;
   }
 
@@ -431,36 +670,81 @@ void checkMQTTloop()
     return;
   }
 
-  static unsigned long lastCheck = millis();
+  unsigned long start_ms = millis();
 
-  if (millis() > lastCheck + MQTT_LOOP_MS)
-  {
+  switch (vars::state) {
+  case Waiting:
+    if ((long)(start_ms - vars::nextAttempt_ms) < 0)
+      return;
+    if(!Wifi::ntpIsSynchronized() && params::ssl_enabled && !params::ssl_insecure) // secured SSL is not possible without NTP
+      return;
+
+    counters::connectAttemptsCount++;
+    vars::attemptStart_ms = start_ms;
+    Serial.print(F("Trying to connect to MQTT Server '"));
+    Serial.print(params::server.c_str());
+    Serial.println(F("' ..."));
+    vars::state = Connecting;
+
+    #ifdef MQTT_CONNECT_TASK_ENABLED
+    vars::taskDone = false;
+    vars::taskRunning = true;
+    if (xTaskCreatePinnedToCore(connectTask, "RFLinkMqtt", MQTT_CONNECT_TASK_STACK_SIZE, nullptr, MQTT_CONNECT_TASK_PRIORITY, nullptr, MQTT_CONNECT_TASK_CORE) != pdPASS) {
+      vars::taskRunning = false;
+      Serial.println(F("Failed to start MQTT connect task"));
+      scheduleRetry();
+    }
+    #endif
+    return;
+
+  case Connecting:
+  case Handshaking:
+  case Subscribing:
+    // only without MQTT_CONNECT_TASK_ENABLED, the task has its own loop
+    completeStep(vars::state, runStep(vars::state));
+    noteBlocked(start_ms);
+    return;
+
+  case Connected:
     if (!MQTTClient.connected()) {
-      reconnect(1);
+      Serial.println(F("MQTT connection lost"));
+      closeConnection();
+      vars::state = Waiting;
+      vars::nextAttempt_ms = start_ms + vars::backoff_ms;
+      return;
     }
 
-    if (bResub)
+    if (millis() > vars::lastLoop_ms + MQTT_LOOP_MS)
     {
-      // Once connected, resubscribe
-      MQTTClient.subscribe(params::topic_in.c_str());
-      bResub = false;
-      delay(10);
+      MQTTClient.loop();
+      vars::lastLoop_ms = millis();
+      noteBlocked(start_ms);
     }
-    MQTTClient.loop();
-    lastCheck = millis();
+    return;
   }
-
 }
 
 void getStatusJsonString(JsonObject &output) {
   auto && mqtt = output.createNestedObject("mqtt");
 
   if(params::enabled) {
-    if( MQTTClient.connected() ) {
+    if( vars::state == Connected && MQTTClient.connected() ) {
       mqtt["status"] = "connected";
     } else {
       mqtt["status"] = "error";
     }
+    mqtt["state"] = connectionStateNames[vars::state];
+    if (vars::state == Waiting) {
+      long retry_ms = (long)(vars::nextAttempt_ms - millis());
+      mqtt["retry_in_ms"] = retry_ms > 0 ? retry_ms : 0;
+    }
+    else if (vars::state != Connected)
+      mqtt["connecting_ms"] = millis() - vars::attemptStart_ms;
+    mqtt["connect_attempts"] = counters::connectAttemptsCount;
+    mqtt["connect_failures"] = counters::connectFailuresCount;
+    mqtt["last_connect_latency_ms"] = counters::lastConnectLatency_ms;
+    mqtt["max_blocked_ms"] = counters::maxBlocked_ms;
+    mqtt["total_blocked_ms"] = counters::totalBlocked_ms;
   } else {
     mqtt["status"] = "disabled";
   }
@@ -42,7 +42,6 @@ namespace RFLink { namespace Mqtt {
     extern const char *mqtt_ca_cert_filename;
 
     extern Config::ConfigItem configItems[];
-    extern struct timeval lastMqttConnectionAttemptTime;
 
     namespace params {
         extern bool enabled;
@@ -58,6 +57,9 @@ namespace RFLink { namespace Mqtt {
         extern bool lwt_enabled;
         extern String topic_lwt;
 
+        extern bool json_enabled;
+        extern bool record_enabled; // EventRecord bytes rather than text, for consumers which decode it themselves
+
         #ifndef RFLINK_MQTT_CLIENT_SSL_DISABLED
         extern bool ssl_enabled;
         extern bool ssl_insecure;
@@ -65,9 +67,29 @@ namespace RFLink { namespace Mqtt {
         #endif
     }
 
+    namespace counters {
+        extern unsigned long int connectAttemptsCount;
+        extern unsigned long int connectFailuresCount;
+        extern unsigned long int lastConnectLatency_ms; // from the first connection step to the subscription
+        extern unsigned long int maxBlocked_ms;         // longest main loop wait for the broker: connection step, publish or loop()
+        extern unsigned long int totalBlocked_ms;
+    }
+
 void setup_MQTT();
-void reconnect(int retryCount=-1, bool force=false);
-void publishMsg();
+/**
+ * Drops the connection to the broker, if any, and starts a new one from the next checkMQTTloop()
+ * */
+void reconnect();
+/**
+ * @return true when publishEvent() needs the text of the event, neither JSON nor the record being published
+ * */
+bool needsEventText();
+/**
+ * Publishes the event to topic_out, as text, as a JSON object if json_enabled or as the record itself if
+ * record_enabled. Nothing is formatted while MQTT is disabled or disconnected.
+ * @param text formatEventText() output, only read when needsEventText()
+ * */
+void publishEvent(const EventRecord &event, const char *text);
 void checkMQTTloop();
 
 void paramsUpdatedCallback();
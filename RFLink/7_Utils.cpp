@@ -403,116 +403,191 @@ bool decode_pwm(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses
         return false;
     }
 
-    const uint8_t bitsPerByte = 8;
-    //const uint8_t expectedByteCount = expectedBitCount / bitsPerByte;
-    const uint8_t endBitCount = expectedBitCount + bitOffset;
+    uint32_t words[(255 + 31) / 32];
+    RFLink::Utils::PulseThresholds thresholds(shortPulseMinDuration, shortPulseMaxDuration, longPulseMinDuration, longPulseMaxDuration);
+    RFLink::Utils::SliceResult result = RFLink::Utils::slice_pwm(words, expectedBitCount, pulses, pulsesCount + 1, pulseIndex, thresholds);
+    RFLink::Utils::unpack_words(frame, bitOffset, words, result.bitCount);
 
-    for(uint8_t bitIndex = bitOffset; bitIndex < endBitCount; bitIndex++)
+    if (result.bitCount < expectedBitCount)
     {
-        int currentFrameByteIndex = bitIndex / bitsPerByte;
-        uint16_t bitDuration = pulses[pulseIndex];
-        uint8_t bitMask = (0x80 >> (bitIndex % bitsPerByte));
+        #ifdef PWM_DEBUG
+        Serial.print(F("PWM: Invalid duration at pulse "));
+        Serial.print(result.stopIndex);
+        Serial.print(F(" - bit "));
+        Serial.print(bitOffset + result.bitCount);
+        Serial.print(F(": "));
+        Serial.println(pulses[result.stopIndex] * RFLink::Signal::RawSignal.Multiply);         
+        #endif
+        return false; // unexpected bit duration, invalid format
+    }
 
-        if (value_between(bitDuration, shortPulseMinDuration, shortPulseMaxDuration))
-        {
-            frame[currentFrameByteIndex] &= ~bitMask;
-        }
-        else if (value_between(bitDuration, longPulseMinDuration, longPulseMaxDuration))
-        {
-            frame[currentFrameByteIndex] |= bitMask;
-        }
-        else
-        {
-            #ifdef PWM_DEBUG
-            Serial.print(F("PWM: Invalid duration at pulse "));
-            Serial.print(pulseIndex);
-            Serial.print(F(" - bit "));
-            Serial.print(bitIndex);
-            Serial.print(F(": "));
-            Serial.println(bitDuration * RFLink::Signal::RawSignal.Multiply);         
-            #endif
-            return false; // unexpected bit duration, invalid format
-        }
+    return true;
+}
 
+bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfBitMinDuration, uint16_t halfBitMaxDuration)
+{
+    uint32_t words[(255 + 31) / 32];
+    RFLink::Utils::PulseThresholds thresholds(halfBitMinDuration, halfBitMaxDuration, halfBitMinDuration * 2, halfBitMaxDuration * 2);
+    RFLink::Utils::SliceResult result = RFLink::Utils::slice_manchester(words, expectedBitCount, pulses, pulsesCount, pulseIndex, nextBit, secondPulse, thresholds);
 
-        pulseIndex += 2;
+    if (result.bitCount < expectedBitCount)
+    {
+        #ifdef MANCHESTER_DEBUG
+        if (result.stopIndex < pulsesCount)
+        {
+            Serial.print(F("Manchester: Pulse has unexpected duration: index = "));
+            Serial.print(result.stopIndex);
+            Serial.print(" - value = ");
+            Serial.println(pulses[result.stopIndex]);
+        }
+        #endif
+        return false;
     }
 
+    RFLink::Utils::unpack_words(frame, 0, words, expectedBitCount);
     return true;
 }
 
-bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfBitMinDuration, uint16_t halfBitMaxDuration)
-{
-    int bitIndex = 0;
-    const uint8_t bitsPerByte = 8;
-    const uint8_t expectedByteCount = expectedBitCount / bitsPerByte;
-    const uint16_t fullBitMinDuration = halfBitMinDuration * 2;
-    const uint16_t fullBitMaxDuration = halfBitMaxDuration * 2;
+namespace RFLink {
+  namespace Utils {
 
-    while ((pulseIndex < pulsesCount) && (bitIndex < expectedBitCount))
+    PulseThresholds::PulseThresholds(uint16_t shortMinDuration, uint16_t shortMaxDuration, uint16_t longMinDuration, uint16_t longMaxDuration)
     {
-        uint16_t pulseDuration = pulses[pulseIndex];
-        int currentFrameByteIndex = bitIndex / bitsPerByte;
+      // value > min && value < max  <=>  (uint16_t)(value - (min + 1)) < max - min - 1
+      shortOrigin = shortMinDuration + 1;
+      shortSpan = (shortMaxDuration > shortMinDuration) ? shortMaxDuration - shortMinDuration - 1 : 0;
+      longOrigin = longMinDuration + 1;
+      longSpan = (longMaxDuration > longMinDuration) ? longMaxDuration - longMinDuration - 1 : 0;
+    }
 
-        if (value_between(pulseDuration, fullBitMinDuration, fullBitMaxDuration))
-        {
-            if (!secondPulse)
-            {
-                #ifdef MANCHESTER_DEBUG
-                Serial.print(F("Manchester: Cannot have long pulse as a first pulse: index = "));
-                Serial.print(pulseIndex);
-                Serial.print(" - value = ");
-                Serial.println(pulseDuration);
-                #endif
-                return false;
-            }
+    /**
+     * Accumulates bits in a register and stores it every 32 bits
+     * */
+    class WordPacker {
+    private:
+      uint32_t *words;
+      uint32_t accumulator;
 
-            frame[currentFrameByteIndex] <<= 1;
-            frame[currentFrameByteIndex] |= nextBit;
+    public:
+      uint16_t bitCount;
 
-            nextBit = 1 - nextBit;
-            bitIndex++;
+      inline WordPacker(uint32_t *words) : words(words), accumulator(0), bitCount(0) {}
+
+      inline void push(uint32_t bit)
+      {
+        accumulator = (accumulator << 1) | bit;
+        if ((++bitCount & 31) == 0)
+        {
+          words[(bitCount >> 5) - 1] = accumulator;
+          accumulator = 0;
         }
-        else if (value_between(pulseDuration, halfBitMinDuration, halfBitMaxDuration))
+      }
+
+      inline void flush()
+      {
+        if (bitCount & 31)
+          words[bitCount >> 5] = accumulator << (32 - (bitCount & 31));
+      }
+    };
+
+    SliceResult slice_pwm(uint32_t words[], uint16_t maxBits, uint16_t const pulses[], int pulseEnd, int pulseIndex, const PulseThresholds &thresholds)
+    {
+      // Bounding the bit count once keeps the pulse index out of the inner loop
+      int available = (pulseEnd - pulseIndex + 1) / 2;
+      uint16_t bitCount = (available < maxBits) ? MAX(available, 0) : maxBits;
+      uint16_t const *pulse = pulses + pulseIndex;
+      uint16_t done = 0;
+
+      while (done < bitCount)
+      {
+        uint8_t wordBits = MIN(bitCount - done, 32);
+        uint32_t accumulator = 0;
+        uint8_t i;
+
+        for (i = 0; i < wordBits; i++, pulse += 2)
         {
-            if (secondPulse)
-            {
-                frame[currentFrameByteIndex] <<= 1;
-                frame[currentFrameByteIndex] |= nextBit;
+          bool isShort = thresholds.isShort(*pulse);
+          if (!(isShort | thresholds.isLong(*pulse)))
+            break; // unexpected bit duration, invalid format
+          accumulator = (accumulator << 1) | !isShort;
+        }
 
-                bitIndex++;
-            }
+        if (i)
+          words[done >> 5] = accumulator << (32 - i);
+        done += i;
+        if (i < wordBits)
+          break;
+      }
 
-            secondPulse = !secondPulse;
+      SliceResult result = {done, pulseIndex + 2 * done};
+      return result;
+    }
+
+    SliceResult slice_manchester(uint32_t words[], uint16_t maxBits, uint16_t const pulses[], int pulseEnd, int pulseIndex, uint8_t nextBit, bool secondPulse, const PulseThresholds &thresholds)
+    {
+      WordPacker packer(words);
+
+      while (packer.bitCount < maxBits && pulseIndex < pulseEnd)
+      {
+        uint16_t duration = pulses[pulseIndex];
+
+        if (thresholds.isLong(duration))
+        {
+          if (!secondPulse)
+            break; // cannot have a long pulse as a first pulse
+
+          packer.push(nextBit);
+          nextBit = 1 - nextBit;
         }
-        else
+        else if (thresholds.isShort(duration))
         {
-            #ifdef MANCHESTER_DEBUG
-            Serial.print(F("Manchester: Pulse has unexpected duration: index = "));
-            Serial.print(pulseIndex);
-            Serial.print(" - value = ");
-            Serial.println(pulseDuration);
-            #endif
-            return false;
+          if (secondPulse)
+            packer.push(nextBit);
+
+          secondPulse = !secondPulse;
         }
+        else
+          break;
 
         pulseIndex++;
-    }
+      }
 
-    // The low part of the down front gets mixed with the interframe silence and is thus too long to be placed in the pulses
-    // This means the last bit is never placed in the frame and we must manually add it into the last byte
-    if ((pulseIndex == pulsesCount) && (bitIndex == expectedBitCount - 1))
-    {
-        frame[expectedByteCount - 1] <<= 1;
-        frame[expectedByteCount - 1] |= nextBit;
-        bitIndex++;
+      // Final transition mixed with the interframe silence, see decode_manchester()
+      if (pulseIndex == pulseEnd && packer.bitCount + 1 == maxBits)
+        packer.push(nextBit);
+
+      packer.flush();
+      SliceResult result = {packer.bitCount, pulseIndex};
+      return result;
     }
 
-    return (bitIndex == expectedBitCount);
-}
+    void unpack_words(uint8_t frame[], uint16_t bitOffset, const uint32_t words[], uint16_t bitCount)
+    {
+      uint16_t done = 0;
+
+      // Whole bytes go straight from the words when the frame is byte aligned
+      if ((bitOffset & 7) == 0)
+      {
+        uint8_t *out = frame + (bitOffset >> 3);
+        for (; done + 8 <= bitCount; done += 8)
+          *out++ = words[done >> 5] >> (24 - (done & 31));
+      }
 
-namespace RFLink {
-  namespace Utils {
+      while (done < bitCount)
+      {
+        uint16_t position = bitOffset + done;
+        uint8_t shift = position & 7;
+        uint8_t length = MIN(8 - shift, bitCount - done);
+        uint32_t word = words[done >> 5] << (done & 31);
+        if ((done & 31) + length > 32)
+          word |= words[(done >> 5) + 1] >> (32 - (done & 31));
+
+        uint8_t mask = (0xFF >> (8 - length)) << (8 - shift - length);
+        uint8_t value = (word >> (32 - length)) << (8 - shift - length);
+        frame[position >> 3] = (frame[position >> 3] & ~mask) | (value & mask);
+        done += length;
+      }
+    }
 
     const uint8_t BitArray::_masks[8] = {128, 64, 32, 16, 8, 4, 2, 1};
 
@@ -532,25 +607,124 @@ namespace RFLink {
 
     }
 
-    uint32_t BitArray::getUInt(const uint16_t firstBitPosition, const uint16_t length) {
-
-      int32_t result = 0;
-      for (uint16_t i = firstBitPosition; i < firstBitPosition + length; i++) {
-        result <<= 1;
-        //Serial.printf("byte %i bit %i = %i\r\n", (int) i / 8, (int) i % 8, (storage[i / 8] & (0x80 >> (i%8)) ) != 0);
-        if ((storage[i / 8] & (0x80 >> (i%8)) ) != 0)
-          result += 1;
-      }
-
-      return result;
-    }
-
   } //end of Utils namespace
 } // end of RFLink namespace
 
 
 // Unit testing
 #ifdef _TEST
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Byte at a time PWM decoder that decode_pwm() used before the word slicer, kept as a reference
+static bool reference_decode_pwm(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint16_t shortMin, uint16_t shortMax, uint16_t longMin, uint16_t longMax, uint8_t bitOffset)
+{
+    if (pulseIndex + (expectedBitCount - 1) * 2 > pulsesCount)
+        return false;
+
+    for (uint8_t bitIndex = bitOffset; bitIndex < expectedBitCount + bitOffset; bitIndex++)
+    {
+        uint8_t bitMask = (0x80 >> (bitIndex % 8));
+        if (value_between(pulses[pulseIndex], shortMin, shortMax))
+            frame[bitIndex / 8] &= ~bitMask;
+        else if (value_between(pulses[pulseIndex], longMin, longMax))
+            frame[bitIndex / 8] |= bitMask;
+        else
+            return false;
+        pulseIndex += 2;
+    }
+    return true;
+}
+
+// Same for decode_manchester()
+static bool reference_decode_manchester(uint8_t frame[], uint8_t expectedBitCount, uint16_t const pulses[], const int pulsesCount, int pulseIndex, uint8_t nextBit, bool secondPulse, uint16_t halfMin, uint16_t halfMax)
+{
+    int bitIndex = 0;
+    while ((pulseIndex < pulsesCount) && (bitIndex < expectedBitCount))
+    {
+        uint16_t duration = pulses[pulseIndex];
+        if (value_between(duration, (uint16_t)(halfMin * 2), (uint16_t)(halfMax * 2)))
+        {
+            if (!secondPulse)
+                return false;
+            frame[bitIndex / 8] = (frame[bitIndex / 8] << 1) | nextBit;
+            nextBit = 1 - nextBit;
+            bitIndex++;
+        }
+        else if (value_between(duration, halfMin, halfMax))
+        {
+            if (secondPulse)
+            {
+                frame[bitIndex / 8] = (frame[bitIndex / 8] << 1) | nextBit;
+                bitIndex++;
+            }
+            secondPulse = !secondPulse;
+        }
+        else
+            return false;
+        pulseIndex++;
+    }
+    if ((pulseIndex == pulsesCount) && (bitIndex == expectedBitCount - 1))
+    {
+        frame[expectedBitCount / 8 - 1] = (frame[expectedBitCount / 8 - 1] << 1) | nextBit;
+        bitIndex++;
+    }
+    return (bitIndex == expectedBitCount);
+}
+
+// Random PWM run with 500/1000 us pulses, the odd ones carrying the bits, sometimes broken by an invalid pulse
+static int make_pwm_pulses(uint16_t pulses[], int bitCount)
+{
+    int count = 0;
+    pulses[count++] = 4000;
+    for (int i = 0; i < bitCount; i++)
+    {
+        pulses[count++] = (rand() & 1) ? 950 + rand() % 100 : 450 + rand() % 100;
+        pulses[count++] = 300;
+    }
+    if ((rand() & 7) == 0)
+        pulses[1 + 2 * (rand() % bitCount)] = 700;
+    return count - 1;
+}
+
+// Random Manchester run with 640 us half bits, as sent by Somfy RTS remotes
+static int make_manchester_pulses(uint16_t pulses[], int bitCount)
+{
+    int count = 1;
+    uint8_t previous = rand() & 1;
+    pulses[count++] = 640;
+    for (int i = 1; i < bitCount; i++)
+    {
+        uint8_t bit = rand() & 1;
+        if (bit == previous)
+        {
+            pulses[count++] = 640;
+            pulses[count++] = 640;
+        }
+        else
+            pulses[count++] = 1280;
+        previous = bit;
+    }
+    if ((rand() & 7) == 0)
+        pulses[1 + rand() % (count - 1)] = 960;
+    return count - 1;
+}
+
+// Bit at a time getUInt() that BitArray used before extract_bits(), kept as a reference
+static uint32_t reference_get_uint(const uint8_t storage[], uint16_t firstBitPosition, uint16_t length)
+{
+    int32_t result = 0;
+    for (uint16_t i = firstBitPosition; i < firstBitPosition + length; i++)
+    {
+        result <<= 1;
+        if ((storage[i / 8] & (0x80 >> (i % 8))) != 0)
+            result += 1;
+    }
+    return result;
+}
+
 int main(int argc, char **argv)
 {
     fprintf(stderr, "util:: test\r\n");
@@ -560,6 +734,151 @@ int main(int argc, char **argv)
     fprintf(stderr, "util::crc8(): odd parity:  %02X\r\n", crc8(msg, 3, 0x80, 0x00));
     fprintf(stderr, "util::crc8(): even parity: %02X\r\n", crc8(msg, 4, 0x80, 0x00));
 
-    return 0;
+    // table driven CRCs must match the bitwise ones, for the polynomials used by the plugins and a few others
+    using namespace RFLink::Utils;
+    uint8_t data[64];
+    int failures = 0;
+    srand(1);
+    for (int round = 0; round < 2000; round++)
+    {
+        unsigned length = rand() % sizeof(data);
+        uint8_t init = rand();
+        for (unsigned i = 0; i < length; i++)
+            data[i] = rand();
+
+        failures += crc4(data, length, 0x13, init & 0x0f) != crc4_table<0x13>(data, length, init & 0x0f);
+        failures += crc4(data, length, 0x03, init & 0x0f) != crc4_table<0x03>(data, length, init & 0x0f);
+        failures += crc7(data, length, 0x09, init & 0x7f) != crc7_table<0x09>(data, length, init & 0x7f);
+        failures += crc8(data, length, 0x31, init) != crc8_table<0x31>(data, length, init);
+        failures += crc8(data, length, 0x80, init) != crc8_table<0x80>(data, length, init);
+        failures += crc8(data, length, 0x07, init) != crc8_table<0x07>(data, length, init);
+        failures += crc8le(data, length, 0x07, init) != crc8le_table<0x07>(data, length, init);
+        failures += crc8le(data, length, 0x31, init) != crc8le_table<0x31>(data, length, init);
+        failures += crc16(data, length, 0x1021, init * 257) != crc16_table<0x1021>(data, length, init * 257);
+        failures += crc16(data, length, 0x8005, 0) != crc16_table<0x8005>(data, length, 0);
+        failures += crc16lsb(data, length, 0x8408, init * 257) != crc16lsb_table<0x8408>(data, length, init * 257);
+        failures += crc16lsb(data, length, 0xa001, 0xffff) != crc16lsb_table<0xa001>(data, length, 0xffff);
+    }
+    fprintf(stderr, "util::crc*_table(): %d mismatches\r\n", failures);
+
+    // speed, 8 bytes messages as decoded by most plugins
+    const int loops = 1000000;
+    volatile uint8_t sink = 0;
+    clock_t start = clock();
+    for (int i = 0; i < loops; i++)
+    {
+        data[0] = i;
+        sink += crc8(data, 8, 0x31, 0);
+    }
+    double bitwise_ns = (clock() - start) * 1e9 / CLOCKS_PER_SEC / loops;
+    start = clock();
+    for (int i = 0; i < loops; i++)
+    {
+        data[0] = i;
+        sink += crc8_table<0x31>(data, 8, 0);
+    }
+    double table_ns = (clock() - start) * 1e9 / CLOCKS_PER_SEC / loops;
+    fprintf(stderr, "util::crc8() 8 bytes: bitwise %.1f ns, table %.1f ns\r\n", bitwise_ns, table_ns);
+
+    // word slicers must give the same frames as the byte at a time decoders
+    uint16_t pulses[2 * 128 + 8];
+    uint8_t frame[32], expected[32];
+    int sliceFailures = 0;
+    for (int round = 0; round < 20000; round++)
+    {
+        int bitCount = 1 + rand() % 120;
+        int pulsesCount = make_pwm_pulses(pulses, bitCount);
+        uint8_t bitOffset = rand() % 9;
+        uint8_t fill = rand();
+        memset(frame, fill, sizeof(frame));
+        memset(expected, fill, sizeof(expected));
+        bool result = decode_pwm(frame, bitCount, pulses, pulsesCount, 1, 400, 600, 900, 1100, bitOffset);
+        bool expectedResult = reference_decode_pwm(expected, bitCount, pulses, pulsesCount, 1, 400, 600, 900, 1100, bitOffset);
+        sliceFailures += result != expectedResult || memcmp(frame, expected, sizeof(frame)) != 0;
+
+        bitCount = 8 * (1 + rand() % 15);
+        pulsesCount = make_manchester_pulses(pulses, bitCount);
+        memset(frame, 0, sizeof(frame));
+        memset(expected, 0, sizeof(expected));
+        result = decode_manchester(frame, bitCount, pulses, pulsesCount, 1, 1, true, 480, 800);
+        expectedResult = reference_decode_manchester(expected, bitCount, pulses, pulsesCount, 1, 1, true, 480, 800);
+        sliceFailures += result != expectedResult || (result && memcmp(frame, expected, sizeof(frame)) != 0);
+    }
+    fprintf(stderr, "util::slice_pwm/manchester(): %d mismatches\r\n", sliceFailures);
+    failures += sliceFailures;
+
+    // speed, 64 bits frames, with thresholds unknown at compile time as they are on the device
+    volatile uint16_t bounds[4] = {400, 600, 900, 1100};
+    srand(2);
+    int pulsesCount;
+    do
+        pulsesCount = make_pwm_pulses(pulses, 64);
+    while (!reference_decode_pwm(frame, 64, pulses, pulsesCount, 1, 400, 600, 900, 1100, 0));
+    start = clock();
+    for (int i = 0; i < loops; i++)
+    {
+        pulses[1] = 500 + (i & 1) * 500;
+        sink += reference_decode_pwm(frame, 64, pulses, pulsesCount, 1, bounds[0], bounds[1], bounds[2], bounds[3], 0) + frame[0];
+    }
+    double byte_ns = (clock() - start) * 1e9 / CLOCKS_PER_SEC / loops;
+    uint32_t words[2];
+    start = clock();
+    for (int i = 0; i < loops; i++)
+    {
+        pulses[1] = 500 + (i & 1) * 500;
+        RFLink::Utils::PulseThresholds thresholds(bounds[0], bounds[1], bounds[2], bounds[3]);
+        sink += slice_pwm(words, 64, pulses, pulsesCount + 1, 1, thresholds).bitCount + words[0];
+    }
+    double word_ns = (clock() - start) * 1e9 / CLOCKS_PER_SEC / loops;
+    fprintf(stderr, "util::slice_pwm() 64 bits: byte decoder %.1f ns, word slicer %.1f ns\r\n", byte_ns, word_ns);
+
+    // field extraction must match the bit at a time reads, from bytes and from words, in all bit orders
+    RFLink::Utils::BitArray bitArray;
+    uint32_t storageWords[sizeof(bitArray.storage) / 4];
+    int fieldFailures = 0;
+    for (int round = 0; round < 2000; round++)
+    {
+        for (unsigned i = 0; i < sizeof(bitArray.storage); i++)
+            bitArray.storage[i] = rand();
+        for (unsigned i = 0; i < sizeof(storageWords) / 4; i++)
+            storageWords[i] = (uint32_t)bitArray.storage[4 * i] << 24 | (uint32_t)bitArray.storage[4 * i + 1] << 16 | (uint32_t)bitArray.storage[4 * i + 2] << 8 | bitArray.storage[4 * i + 3];
+
+        for (int field = 0; field < 32; field++)
+        {
+            uint8_t length = 1 + rand() % 32;
+            uint16_t first = rand() % (sizeof(bitArray.storage) * 8 - length + 1);
+            uint32_t expectedValue = reference_get_uint(bitArray.storage, first, length);
+
+            uint32_t reversed = 0;
+            for (uint8_t i = 0; i < length; i++)
+                reversed |= ((expectedValue >> i) & 1) << (length - 1 - i);
+            uint32_t reflected = 0;
+            for (uint8_t i = 0; i < length; i++)
+                reflected |= ((expectedValue >> i) & 1) << ((i & ~3) + 3 - (i & 3));
+
+            fieldFailures += bitArray.getUInt(first, length) != expectedValue;
+            fieldFailures += extract_bits(storageWords, first, length) != expectedValue;
+            fieldFailures += bitArray.getUInt(first, length, BITS_LSB_FIRST) != reversed;
+            fieldFailures += extract_bits(storageWords, first, length, BITS_LSB_FIRST) != reversed;
+            if ((length & 3) == 0)
+                fieldFailures += bitArray.getUInt(first, length, BITS_NIBBLE_REFLECTED) != reflected;
+        }
+
+        typedef BitLayout<BitField<0, 8>, BitField<5, 19>, BitField<12, 12>, BitField<44, 12, BITS_LSB_FIRST>, BitField<479, 32>> Layout;
+        uint32_t values[Layout::count];
+        bitArray.getFields<Layout>(values);
+        fieldFailures += values[0] != reference_get_uint(bitArray.storage, 0, 8);
+        fieldFailures += values[1] != reference_get_uint(bitArray.storage, 5, 19);
+        fieldFailures += values[2] != reference_get_uint(bitArray.storage, 12, 12);
+        fieldFailures += values[3] != bitArray.getUInt(44, 12, BITS_LSB_FIRST);
+        fieldFailures += values[4] != reference_get_uint(bitArray.storage, 479, 32);
+        Layout::extract(storageWords, values);
+        fieldFailures += values[1] != reference_get_uint(bitArray.storage, 5, 19);
+        fieldFailures += values[4] != reference_get_uint(bitArray.storage, 479, 32);
+    }
+    fprintf(stderr, "util::extract_bits(): %d mismatches\r\n", fieldFailures);
+    failures += fieldFailures;
+
+    return failures != 0;
 }
 #endif /* _TEST */
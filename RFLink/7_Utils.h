@@ -30,6 +30,7 @@
 #define INCLUDE_UTIL_H_
 
 #include <stdint.h>
+#include <Arduino.h>
 
 // Helper macros, collides with MSVC's stdlib.h unless NOMINMAX is used
 #ifndef MAX
@@ -137,6 +138,141 @@ uint16_t crc16lsb(uint8_t const message[], unsigned nBytes, uint16_t polynomial,
 /// @return CRC value
 uint16_t crc16(uint8_t const message[], unsigned nBytes, uint16_t polynomial, uint16_t init);
 
+namespace RFLink {
+  namespace Utils {
+
+    /**
+     * Table driven versions of the CRC functions above, giving identical results.
+     * The polynomial is a template parameter: the 256 entries table of each polynomial is computed
+     * by the compiler and stored in flash, and only the tables of the polynomials used by the
+     * compiled plugins end up in the firmware. For instance crc8_table<0x31>(data, 4, 0).
+     * */
+    namespace crc_tables {
+
+      template <int... I> struct IndexList {};
+      template <int N, int... I> struct MakeIndexList : MakeIndexList<N - 1, N - 1, I...> {};
+      template <int... I> struct MakeIndexList<0, I...> { typedef IndexList<I...> type; };
+
+      // 8 steps of the bitwise algorithm, most significant bit first
+      constexpr uint32_t msbSteps(uint32_t remainder, uint32_t polynomial, uint32_t topBit, uint32_t mask, int steps)
+      {
+        return steps == 0 ? remainder
+                          : msbSteps(((remainder & topBit) ? ((remainder << 1) ^ polynomial) : (remainder << 1)) & mask, polynomial, topBit, mask, steps - 1);
+      }
+
+      // 8 steps of the bitwise algorithm, least significant bit first (reflected)
+      constexpr uint32_t lsbSteps(uint32_t remainder, uint32_t polynomial, int steps)
+      {
+        return steps == 0 ? remainder
+                          : lsbSteps((remainder & 1) ? ((remainder >> 1) ^ polynomial) : (remainder >> 1), polynomial, steps - 1);
+      }
+
+      template <typename T>
+      constexpr T entry(int index, T polynomial, bool reflected)
+      {
+        return reflected ? (T)lsbSteps(index, polynomial, 8)
+                         : (T)msbSteps((uint32_t)index << (sizeof(T) * 8 - 8), polynomial, 1UL << (sizeof(T) * 8 - 1), (1UL << (sizeof(T) * 8)) - 1, 8);
+      }
+
+      constexpr uint8_t reverse8(uint8_t x)
+      {
+        return (uint8_t)(((x & 0x01) << 7) | ((x & 0x02) << 5) | ((x & 0x04) << 3) | ((x & 0x08) << 1) |
+                         ((x & 0x10) >> 1) | ((x & 0x20) >> 3) | ((x & 0x40) >> 5) | ((x & 0x80) >> 7));
+      }
+
+      template <typename T, T Polynomial, bool Reflected, typename Indexes>
+      struct TableData;
+
+      template <typename T, T Polynomial, bool Reflected, int... I>
+      struct TableData<T, Polynomial, Reflected, IndexList<I...>>
+      {
+        static const T values[sizeof...(I)];
+      };
+
+      template <typename T, T Polynomial, bool Reflected, int... I>
+      const T TableData<T, Polynomial, Reflected, IndexList<I...>>::values[sizeof...(I)] PROGMEM = {entry<T>(I, Polynomial, Reflected)...};
+
+      template <typename T, T Polynomial, bool Reflected>
+      struct Table : TableData<T, Polynomial, Reflected, typename MakeIndexList<256>::type> {};
+
+      template <uint8_t Polynomial, bool Reflected>
+      inline uint8_t read8(uint8_t index)
+      {
+        typedef Table<uint8_t, Polynomial, Reflected> table;
+        return pgm_read_byte(&table::values[index]);
+      }
+
+      template <uint16_t Polynomial, bool Reflected>
+      inline uint16_t read16(uint8_t index)
+      {
+        typedef Table<uint16_t, Polynomial, Reflected> table;
+        return pgm_read_word(&table::values[index]);
+      }
+    }
+
+    /// Same as crc4()
+    template <uint8_t Polynomial>
+    inline uint8_t crc4_table(uint8_t const message[], unsigned nBytes, uint8_t init)
+    {
+      uint8_t remainder = init << 4; // LSBs are unused
+      while (nBytes--)
+        remainder = crc_tables::read8<(uint8_t)(Polynomial << 4), false>(remainder ^ *message++);
+      return remainder >> 4;
+    }
+
+    /// Same as crc7()
+    template <uint8_t Polynomial>
+    inline uint8_t crc7_table(uint8_t const message[], unsigned nBytes, uint8_t init)
+    {
+      uint8_t remainder = init << 1; // LSB is unused
+      while (nBytes--)
+        remainder = crc_tables::read8<(uint8_t)(Polynomial << 1), false>(remainder ^ *message++);
+      return remainder >> 1;
+    }
+
+    /// Same as crc8()
+    template <uint8_t Polynomial>
+    inline uint8_t crc8_table(uint8_t const message[], unsigned nBytes, uint8_t init)
+    {
+      uint8_t remainder = init;
+      while (nBytes--)
+        remainder = crc_tables::read8<Polynomial, false>(remainder ^ *message++);
+      return remainder;
+    }
+
+    /// Same as crc8le(), Polynomial and init are given as for crc8le()
+    template <uint8_t Polynomial>
+    inline uint8_t crc8le_table(uint8_t const message[], unsigned nBytes, uint8_t init)
+    {
+      uint8_t remainder = crc_tables::reverse8(init);
+      while (nBytes--)
+        remainder = crc_tables::read8<crc_tables::reverse8(Polynomial), true>(remainder ^ *message++);
+      return remainder;
+    }
+
+    /// Same as crc16lsb(), Polynomial and init already need to be reflected
+    template <uint16_t Polynomial>
+    inline uint16_t crc16lsb_table(uint8_t const message[], unsigned nBytes, uint16_t init)
+    {
+      uint16_t remainder = init;
+      while (nBytes--)
+        remainder = (remainder >> 8) ^ crc_tables::read16<Polynomial, true>((remainder ^ *message++) & 0xFF);
+      return remainder;
+    }
+
+    /// Same as crc16()
+    template <uint16_t Polynomial>
+    inline uint16_t crc16_table(uint8_t const message[], unsigned nBytes, uint16_t init)
+    {
+      uint16_t remainder = init;
+      while (nBytes--)
+        remainder = (remainder << 8) ^ crc_tables::read16<Polynomial, false>((remainder >> 8) ^ *message++);
+      return remainder;
+    }
+
+  }
+}
+
 /// Digest-8 by "LFSR-based Toeplitz hash".
 ///
 /// @param message bytes of message data
@@ -347,6 +483,154 @@ bool decode_manchester(uint8_t frame[], uint8_t expectedBitCount, uint16_t const
 namespace RFLink {
   namespace Utils {
 
+    /**
+     * Pulse duration bounds used by the slicers below, exclusive like value_between().
+     * They are turned once into an origin and a span so that each pulse is classified
+     * with one subtraction and one unsigned comparison per range.
+     * For Manchester, short is the half bit and long the full bit.
+     * */
+    struct PulseThresholds {
+      uint16_t shortOrigin;
+      uint16_t shortSpan;
+      uint16_t longOrigin;
+      uint16_t longSpan;
+
+      PulseThresholds(uint16_t shortMinDuration, uint16_t shortMaxDuration, uint16_t longMinDuration, uint16_t longMaxDuration);
+
+      inline bool isShort(uint16_t duration) const { return (uint16_t)(duration - shortOrigin) < shortSpan; }
+      inline bool isLong(uint16_t duration) const { return (uint16_t)(duration - longOrigin) < longSpan; }
+    };
+
+    /**
+     * Outcome of a slicer call
+     * bitCount is the number of bits written to the words, stopIndex the pulse where slicing stopped:
+     * the first pulse that could not be classified, or the one following the last decoded bit.
+     * */
+    struct SliceResult {
+      uint16_t bitCount;
+      int stopIndex;
+    };
+
+    /**
+     * Classifies a run of PWM pulses, one every two pulses starting at pulseIndex, and packs the bits in
+     * 32 bits words, MSB first: the first bit is bit 31 of words[0], a partial last word is left aligned.
+     * Slicing stops on the first pulse that is neither short nor long, after maxBits bits, or when
+     * pulseEnd is reached. Only pulses[pulseIndex] to pulses[pulseEnd - 1] are read, so pass
+     * RawSignal.Number + 1 to decode up to the last pulse of RawSignal.
+     * words must hold (maxBits + 31) / 32 items.
+     * */
+    SliceResult slice_pwm(uint32_t words[], uint16_t maxBits, uint16_t const pulses[], int pulseEnd, int pulseIndex, const PulseThresholds &thresholds);
+
+    /**
+     * Same as slice_pwm() for Manchester encoded pulses, nextBit and secondPulse having the meaning
+     * described with decode_manchester(), which also details the final transition that is implied
+     * when pulses run out one bit short of maxBits.
+     * */
+    SliceResult slice_manchester(uint32_t words[], uint16_t maxBits, uint16_t const pulses[], int pulseEnd, int pulseIndex, uint8_t nextBit, bool secondPulse, const PulseThresholds &thresholds);
+
+    /**
+     * Copies bitCount bits packed by a slicer into a byte frame, MSB first, starting at bit bitOffset of frame.
+     * Bits of frame outside of that range are left untouched.
+     * */
+    void unpack_words(uint8_t frame[], uint16_t bitOffset, const uint32_t words[], uint16_t bitCount);
+
+    /**
+     * Order in which the bits of a field read by extract_bits() are placed in the returned value
+     * */
+    enum BitOrder : uint8_t {
+      BITS_MSB_FIRST,        // first bit of the field is the most significant bit of the value
+      BITS_LSB_FIRST,        // first bit of the field is the least significant bit of the value
+      BITS_NIBBLE_REFLECTED, // MSB first, then each nibble reflected as by reflect4(), for fields made of whole nibbles
+    };
+
+    inline uint32_t reverse32(uint32_t x)
+    {
+      x = ((x & 0x55555555) << 1) | ((x >> 1) & 0x55555555);
+      x = ((x & 0x33333333) << 2) | ((x >> 2) & 0x33333333);
+      x = ((x & 0x0F0F0F0F) << 4) | ((x >> 4) & 0x0F0F0F0F);
+      x = ((x & 0x00FF00FF) << 8) | ((x >> 8) & 0x00FF00FF);
+      return (x << 16) | (x >> 16);
+    }
+
+    inline uint32_t reflect_nibbles32(uint32_t x)
+    {
+      x = ((x & 0x55555555) << 1) | ((x >> 1) & 0x55555555);
+      return ((x & 0x33333333) << 2) | ((x >> 2) & 0x33333333);
+    }
+
+    inline uint32_t order_bits(uint32_t value, uint8_t length, BitOrder order)
+    {
+      if (order == BITS_LSB_FIRST)
+        return reverse32(value) >> (32 - length);
+      if (order == BITS_NIBBLE_REFLECTED)
+        return reflect_nibbles32(value);
+      return value;
+    }
+
+    /**
+     * Reads a field of 1 to 32 bits starting at bit first, bits being numbered MSB first as decode_pwm() places them.
+     * Only the bytes holding the field are read, in one go, instead of testing each bit.
+     * */
+    inline uint32_t extract_bits(const uint8_t bytes[], uint16_t first, uint8_t length, BitOrder order = BITS_MSB_FIRST)
+    {
+      const uint8_t *source = bytes + (first >> 3);
+      uint8_t byteCount = ((first & 7) + length + 7) >> 3;
+      uint64_t window = 0;
+      for (uint8_t i = 0; i < byteCount; i++)
+        window = (window << 8) | source[i];
+
+      uint32_t value = (uint32_t)(window >> (byteCount * 8 - (first & 7) - length)) & (0xFFFFFFFF >> (32 - length));
+      return order_bits(value, length, order);
+    }
+
+    /**
+     * Same as above, on the words filled by slice_pwm() or slice_manchester()
+     * */
+    inline uint32_t extract_bits(const uint32_t words[], uint16_t first, uint8_t length, BitOrder order = BITS_MSB_FIRST)
+    {
+      const uint32_t *source = words + (first >> 5);
+      uint64_t window = (uint64_t)source[0] << 32;
+      if ((first & 31) + length > 32)
+        window |= source[1];
+
+      return order_bits((uint32_t)((window << (first & 31)) >> (64 - length)), length, order);
+    }
+
+    /**
+     * Compile time description of a field, to be listed in a BitLayout
+     * */
+    template <uint16_t First, uint8_t Length, BitOrder Order = BITS_MSB_FIRST>
+    struct BitField
+    {
+      static_assert(Length >= 1 && Length <= 32, "A field holds 1 to 32 bits");
+
+      template <typename T>
+      static inline uint32_t get(const T source[]) { return extract_bits(source, First, Length, Order); }
+    };
+
+    /**
+     * Compile time description of a frame, reading all its fields in one call:
+     *
+     *   typedef BitLayout<BitField<0, 8>, BitField<12, 12>> SensorLayout;
+     *   uint32_t fields[SensorLayout::count];
+     *   SensorLayout::extract(frame, fields);
+     *
+     * source can be a byte frame or slicer words, positions and masks being constants for the compiler.
+     * */
+    template <typename... Fields>
+    struct BitLayout
+    {
+      static constexpr uint8_t count = sizeof...(Fields);
+
+      template <typename T>
+      static inline void extract(const T source[], uint32_t values[])
+      {
+        uint32_t *value = values;
+        int expand[] = {0, (*value++ = Fields::get(source), 0)...};
+        (void)expand;
+      }
+    };
+
     class BitArray {
 
     private:
@@ -369,11 +653,13 @@ namespace RFLink {
                                     uint16_t longPulseMinDuration,
                                     uint16_t longPulseMaxDuration) {
 
-        return decode_pwm(this->storage, expectedBitCount,
-                          pulses, pulsesCount,
-                          pulseIndex,
-                          shortPulseMinDuration, shortPulseMaxDuration,
-                          longPulseMinDuration, longPulseMaxDuration);
+        uint32_t words[(255 + 31) / 32];
+        PulseThresholds thresholds(shortPulseMinDuration, shortPulseMaxDuration, longPulseMinDuration, longPulseMaxDuration);
+        SliceResult result = slice_pwm(words, expectedBitCount, pulses, pulsesCount + 1, pulseIndex, thresholds);
+        unpack_words(this->storage, 0, words, result.bitCount);
+        currentSize = result.bitCount;
+
+        return (result.bitCount == expectedBitCount);
 
       }
 
@@ -381,7 +667,14 @@ namespace RFLink {
         return (storage[bitNumber / 8] & (0x80 >> (bitNumber%8))) != 0;
       }
 
-      uint32_t getUInt(const uint16_t firstBitPosition, const uint16_t length);
+      inline uint32_t getUInt(const uint16_t firstBitPosition, const uint16_t length, BitOrder order = BITS_MSB_FIRST) {
+        return length ? extract_bits(storage, firstBitPosition, length, order) : 0;
+      }
+
+      template <typename Layout>
+      inline void getFields(uint32_t values[]) {
+        Layout::extract(storage, values);
+      }
 
     }; // end of BitArray class
 
@@ -53,7 +53,7 @@ void splash_OLED()
     u8x8.setPowerSave(0);
 }
 
-void print_OLED()
+void print_OLED(const char *message)
 {
     /*
     static char delim[2] = ";";
@@ -75,9 +75,12 @@ void print_OLED()
         ptr = strtok(NULL, delim);
     }
 */
+    static char lines[PRINT_BUFFER_SIZE];
+
+    strncpy(lines, message, sizeof(lines) - 1);
     u8x8log.print('\f');
-    replacechar(pbuffer, ';', '\n');
-    u8x8log.print(pbuffer);
+    replacechar(lines, ';', '\n');
+    u8x8log.print(lines);
 }
 
 #endif // OLED_ENABLED
\ No newline at end of file
@@ -25,7 +25,7 @@
 
 void setup_OLED();
 void splash_OLED();
-void print_OLED();
+void print_OLED(const char *message);
 
 #endif // OLED_ENABLED
 #endif // OLED_h
\ No newline at end of file
@@ -256,6 +256,14 @@ namespace RFLink {
       }
     }
 
+    bool hasClients() {
+      for (auto & client : clients) {
+        if (!client.ignore && client.connected())
+          return true;
+      }
+      return false;
+    }
+
 
     void restartServer() {
       for (auto & client : clients) {
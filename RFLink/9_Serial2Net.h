@@ -37,6 +37,7 @@ namespace RFLink {
         void broadcastMessage(const char *msg);
         void broadcastMessage(const __FlashStringHelper *buf);
         void broadcastMessage(char c);
+        bool hasClients(); // true when broadcastMessage() has someone to write to
 
         void paramsUpdatedCallback();
         void refreshParametersFromConfig(bool triggerChanges=true);
@@ -99,10 +99,10 @@ boolean Plugin_001(byte function, const char *string)
    //const long PULSE2000 = PULSE2000_D / RawSignal.Multiply;
    //const long PULSE4000 = PULSE4000_D / RawSignal.Multiply;
    //const long PULSE4200 = PULSE4200_D / RawSignal.Multiply;
-   const long PULSE3300 = PULSE3300_D / RawSignal.Multiply;
-   const long PULSE2500 = PULSE2500_D / RawSignal.Multiply;
-   const long PULSE3000 = PULSE3000_D / RawSignal.Multiply;
-   const long PULSE5000 = PULSE5000_D / RawSignal.Multiply;
+   //const long PULSE3300 = PULSE3300_D / RawSignal.Multiply;
+   //const long PULSE2500 = PULSE2500_D / RawSignal.Multiply;
+   //const long PULSE3000 = PULSE3000_D / RawSignal.Multiply;
+   //const long PULSE5000 = PULSE5000_D / RawSignal.Multiply;
    //const long PULSE6000 = PULSE6000_D / RawSignal.Multiply;
    //const long PULSE6500 = PULSE6500_D / RawSignal.Multiply;
 
@@ -376,19 +376,8 @@ boolean Plugin_001(byte function, const char *string)
             //if ( (RawSignal.Pulses[j+26]*RawSignal.Multiply > 2500) && (RawSignal.Pulses[j+26]*RawSignal.Multiply < 3000) && (RawSignal.Pulses[j+26+26]*RawSignal.Multiply > 2500) ) { // first long delay found, make sure we have another at the right position
             if ((RawSignal.Pulses[j + 84] > PULSE1100))
             { // first long delay found, make sure we have another at the right position
-               if (j != 42)
-               {
-                  // Serial.print("RawSignal.Pulses: ");
-                  for (i = 0; i < 84; i++)
-                  {
-                     // Serial.print(RawSignal.Pulses[j + 1 + i]);
-                     // Serial.print(", ");
-                     RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
-                  }
-                  // Serial.println("");
-               }
-               RawSignal.Number = 84;    // New packet length
-               RawSignal.Pulses[0] = 37; // signal the plugin number that should process this packet
+               PluginSelectPulses(j != 42 ? j + 1 : 1, 84); // New packet length, reordered as it was received
+               DispatchResult.routeHint = 37; // signal the plugin number that should process this packet
                return false;             // Conversion done, stop plugin 1 and continue with regular plugins
             }
          }
@@ -564,33 +553,8 @@ boolean Plugin_001(byte function, const char *string)
    }
    #endif
 
-   #if (defined(PLUGIN_046) ||  defined(PLUGIN_064))
-   // ==========================================================================
-   // Beginning of Signal translation for Atlantic/Visonic alarm detectors
-   // 74 pulses sent 1, 4 or 5 times. Pulse 74 = 3968 (064)
-   // ==========================================================================
-   // ==========================================================================
-   // Also Beginning of Signal translation for Auriol & Xiro (046)
-   // ==========================================================================
-   if (RawSignal.Number >= 290)
-   {
-      for (int offset = 0; offset < 74; offset++)
-      {
-         if (RawSignal.Pulses[offset + 74] > PULSE3300 && RawSignal.Pulses[offset + 74 * 2] > PULSE3300 && ((offset > 0 && RawSignal.Pulses[offset] > PULSE3300) || RawSignal.Pulses[offset + 74 * 3] > PULSE3300))
-         {
-            for (i = 0; i < 74; i++)
-            {
-               RawSignal.Pulses[1 + i] = RawSignal.Pulses[offset + i + 1]; // reorder pulse array
-            }
-            RawSignal.Number = 74; // New packet length
-            // RawSignal.Pulses[0] = 46; // signal the plugin number that should process this packet, unused for Auriol/Xiron
-            // RawSignal.Pulses[0] = 64; // signal the plugin number that should process this packet, unused for Atlantic/Visonic
-            return false; // Conversion done, stop plugin 1 and continue with regular plugins
-         }
-      }
-   }
-   // ==========================================================================
-   #endif
+   // Atlantic/Visonic (064), Auriol & Xiro (046): packets of 74 pulses sent several times in a row
+   // are now handed over one by one as sub-frames by PluginRXCall(), see Signal::indexSubFrames()
 
    #ifdef PLUGIN_075
    // ==========================================================================
@@ -699,69 +663,8 @@ boolean Plugin_001(byte function, const char *string)
    // ==========================================================================
    #endif
 
-   #ifdef PLUGIN_070
-   // ==========================================================================
-   // Beginning of Signal translation for SelectPlus
-   // ==========================================================================
-   if (RawSignal.Number >= 290)
-   {
-      for (j = 2; j < 37; j++)
-      { // Only check the total RF packet length we are looking for
-         //if (RawSignal.Pulses[j]*RawSignal.Multiply > 2500) {  // input is going to fast skip to where new part is going to start
-         if (RawSignal.Pulses[j] > PULSE5000)
-         { // input is going to fast skip to where new part is going to start
-            if (j + 36 > RAW_BUFFER_SIZE - 1)
-               break; // cant be the packet we look for
-            //if ( (RawSignal.Pulses[j+26]*RawSignal.Multiply > 2500) && (RawSignal.Pulses[j+26]*RawSignal.Multiply < 3000) && (RawSignal.Pulses[j+26+26]*RawSignal.Multiply > 2500) ) { // first long delay found, make sure we have another at the right position
-            if ((RawSignal.Pulses[j + 36] > PULSE5000) && (RawSignal.Pulses[j + 36 + 36] > PULSE5000))
-            { // first long delay found, make sure we have another at the right position
-               if (j != 36)
-               {
-                  for (i = 0; i < 36; i++)
-                  {
-                     RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
-                  }
-               }
-               RawSignal.Number = 36;    // New packet length
-               RawSignal.Pulses[0] = 70; // signal the plugin number that should process this packet
-               return false;             // Conversion done, stop plugin 1 and continue with regular plugins
-            }
-         }
-      }
-   }
-   // ==========================================================================
-   #endif
-
-   #ifdef PLUGIN_072
-   // ==========================================================================
-   // Beginning of Signal translation for Byron Doorbell
-   // ==========================================================================
-   if (RawSignal.Number >= 290)
-   {
-      for (j = 2; j < 90 /*RawSignal.Number*/; j++)
-      { // Only check twice the total RF packet length we are looking for
-         // Byron SX
-         //if (RawSignal.Pulses[j]*RawSignal.Multiply > 2500) {  // input is going to fast skip to where new part is going to start
-         if (RawSignal.Pulses[j] > PULSE2500)
-         { // input is going to fast skip to where new part is going to start
-            if (j + 26 > RAW_BUFFER_SIZE - 1)
-               break; // cant be the packet we look for
-            //if ( (RawSignal.Pulses[j+26]*RawSignal.Multiply > 2500) && (RawSignal.Pulses[j+26]*RawSignal.Multiply < 3000) && (RawSignal.Pulses[j+26+26]*RawSignal.Multiply > 2500) ) { // first long delay found, make sure we have another at the right position
-            if ((RawSignal.Pulses[j + 26] > PULSE2500) && (RawSignal.Pulses[j + 26] < PULSE3000) && (RawSignal.Pulses[j + 26 + 26] > PULSE2500))
-            { // first long delay found, make sure we have another at the right position
-               for (i = 0; i < 26; i++)
-               {
-                  RawSignal.Pulses[1 + i] = RawSignal.Pulses[j + 1 + i]; // reorder pulse array
-               }
-               RawSignal.Number = 26;    // New packet length
-               RawSignal.Pulses[0] = 72; // signal the plugin number that should process this packet
-               return false;             // Conversion done, stop plugin 1 and continue with regular plugins
-            }
-         }
-      }
-   }
-   // ==========================================================================
-   #endif
+   // SelectPlus (070) and Byron Doorbell (072): repeated packets are handed over one by one
+   // as sub-frames by PluginRXCall(), see Signal::indexSubFrames()
 
    // ==========================================================================
    // End of Signal translation
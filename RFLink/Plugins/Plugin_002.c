@@ -71,6 +71,7 @@
 #define LACROSSE_PLUGIN_ID 002
 #define PLUGIN_DESC_002 "LaCrosse V2"
 #define LACROSSE_PULSECOUNT 104 // also handles 102 pulses!
+#define PLUGIN_PULSES_002 {LACROSSE_PULSECOUNT - 2, LACROSSE_PULSECOUNT - 2}, {LACROSSE_PULSECOUNT, LACROSSE_PULSECOUNT}
 
 #define LACROSSE_MIDLO_D 1100
 #define LACROSSE_MIDHI_D 1480
@@ -177,9 +178,7 @@ boolean Plugin_002(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 4) | (data[12]); // sensor type + ID + checksum
 
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently, save value for later
-   else
+   if (RepeatCache::isRepeat(0, tmpval))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -289,8 +288,6 @@ boolean Plugin_002(byte function, const char *string)
       //return false;
    }
    //==================================================================================
-   RawSignal.Repeats = false;
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_002
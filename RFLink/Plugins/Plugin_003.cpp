@@ -227,6 +227,7 @@ using namespace RFLink::Radio;
 #define KAKU_PLUGIN_ID 003
 #define PLUGIN_DESC_003 "Kaku / AB400D / Impuls / PT2262 / Sartano / Tristate"
 #define KAKU_CodeLength 12                        // number of data bits
+#define PLUGIN_PULSES_003 {(KAKU_CodeLength * 4) + 2, (KAKU_CodeLength * 4) + 2}
 #define KAKU_R_D 300       //360 // 300          // 370? 350 us
 #define KAKU_PULSEMID_D 600 // (17)  510 = KAKU_R*2 not sufficient!
 
@@ -237,11 +238,11 @@ boolean Plugin_003(byte function, const char *string)
 {
    if (RawSignal.Number != (KAKU_CodeLength * 4) + 2)
       return false; // conventionele KAKU bestaat altijd uit 12 data bits plus stop. Ongelijk, dan geen KAKU!
-   if (RawSignal.Pulses[0] == 15)
+   if (DispatchResult.routeHint == 15)
       return true; // Home Easy, skip KAKU
-   if (RawSignal.Pulses[0] == 63)
+   if (DispatchResult.routeHint == 63)
       return false; // No need to test, packet for plugin 63
-   if (RawSignal.Pulses[0] == 19)
+   if (DispatchResult.routeHint == 19)
       return false; // No need to test, packet for plugin 19
    // -------------------------------------------
    const long KAKU_R = KAKU_R_D / RawSignal.Multiply;
@@ -269,9 +270,9 @@ boolean Plugin_003(byte function, const char *string)
    // ==========================================================================
    j = KAKU_PULSEMID; // set MID value
    j--;
-   if (RawSignal.Pulses[0] == 33)
+   if (DispatchResult.routeHint == 33)
    {                           // If device is "Impuls"
-      RawSignal.Pulses[0] = 0; // Unset Impuls conversion indicator
+      DispatchResult.routeHint = 0; // Unset Impuls conversion indicator
       j = KAKU_R;              // Set new (LOWER!) MID value
       devicetype = 5;          // Indicate Impuls device
    }
@@ -410,36 +411,15 @@ boolean Plugin_003(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   //if( (SignalHash!=SignalHashPrevious) || ((RepeatingTimer+500)<millis()) ) {
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (((RepeatingTimer + 1000) > millis()) && (SignalCRC != bitstream2)))
-   {
-      // not seen the RF packet recently
-      if (signaltype == 0x07)
-      {
-         if (((RepeatingTimer + 1000) > millis()) && (SignalCRC != bitstream2))
-         {
-            return true; // skip tristate after normal arc
-         }
-      }
-      //Serial.print("KAKU PREV:");
-      //Serial.println(SignalHashPrevious);
-      if ((SignalHashPrevious == 14) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 14;
-         return true; // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
-      }
-      if ((SignalHashPrevious == 11) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 11;
-         return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
-      }
-      SignalCRC = bitstream2; // store RF packet identifier
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (RepeatCache::isRepeat(0, bitstream2, 500))
+      return true; // already seen the RF packet recently
+
+   if ((signaltype == 0x07) && PluginDecodedRecently(3, 1000))
+      return true; // skip tristate after normal arc
+   if (PluginDecodedRecently(15, 2000))
+      return true; // HomeEasy, eg. cant switch KAKU after HE for 2 seconds
+   if (PluginDecodedRecently(12, 2000))
+      return true; // FA500, eg. cant switch KAKU after FA500 for 2 seconds
    //==================================================================================
    // Determine signal type to sort out the various houdecode/unitcode/button bits and on/off command bits
    //==================================================================================
@@ -620,8 +600,6 @@ boolean Plugin_003(byte function, const char *string)
    display_Footer();
 
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif //PLUGIN_003
@@ -47,6 +47,7 @@
 #define PLUGIN_DESC_004 "NewKaku"
 #define NewKAKU_RawSignalLength 132            // regular KAKU packet length
 #define NewKAKUdim_RawSignalLength 148         // KAKU packet length including DIM bits
+#define PLUGIN_PULSES_004 {NewKAKU_RawSignalLength, NewKAKU_RawSignalLength}, {NewKAKUdim_RawSignalLength, NewKAKUdim_RawSignalLength}
 #define NewKAKU_mT_D 650 // us, approx. in between 1T and 4T
 
 #ifdef PLUGIN_004
@@ -57,16 +58,12 @@ boolean Plugin_004(byte function, const char *string)
    // nieuwe KAKU bestaat altijd uit start bit + 32 bits + evt 4 dim bits. Ongelijk, dan geen NewKAKU
    if ((RawSignal.Number != NewKAKU_RawSignalLength) && (RawSignal.Number != NewKAKUdim_RawSignalLength))
       return false;
-   if (RawSignal.Pulses[0] == 15)
+   if (DispatchResult.routeHint == 15)
       return true; // Home Easy, skip KAKU
    const long NewKAKU_mT = NewKAKU_mT_D / RawSignal.Multiply;
    boolean Bit = 0;
    int i;
-#if defined(ESP32) || defined(ESP8266)
-    uint16_t P0,P1,P2,P3;
-#else
-    byte P0, P1, P2, P3;
-#endif
+   uint16_t P0, P1, P2, P3; // RawSignal.Pulses[] values, which do not fit in a byte
 
    byte dim = 0;
    byte dimbitpresent = 0;
@@ -116,23 +113,13 @@ boolean Plugin_004(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 700) < millis()) || (SignalCRC != bitstream))
-   { // 1000
-      // not seen the RF packet recently
-      //if ((SignalHashPrevious==14) && ((RepeatingTimer+2000)>millis()) ) {
-      //   SignalHash=14;
-      //   return true;                            // SignalHash 14 = HomeEasy, eg. cant switch KAKU after HE for 2 seconds
-      //}
-      if ((SignalHashPrevious == 11) && ((RepeatingTimer + 2000) > millis()))
-      {
-         SignalHash = 11;
-         return true; // SignalHash 11 = FA500, eg. cant switch KAKU after FA500 for 2 seconds
-      }
-
-      SignalCRC = bitstream;
-   }
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 700))
       return true; // already seen the RF packet recently
+
+   //if (PluginDecodedRecently(15, 2000))
+   //   return true;                            // HomeEasy, eg. cant switch KAKU after HE for 2 seconds
+   if (PluginDecodedRecently(12, 2000))
+      return true; // FA500, eg. cant switch KAKU after FA500 for 2 seconds
    //==================================================================================
    // Output
    //==================================================================================
@@ -149,8 +136,6 @@ boolean Plugin_004(byte function, const char *string)
       display_CMD((CMD_Group)((bitstream >> 5) & B01), (CMD_OnOff)((bitstream >> 4) & B01)); // #ALL , #ON
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // Plugin_004
@@ -41,6 +41,7 @@
 #define EURODOMEST_PLUGIN_ID 005
 #define PLUGIN_DESC_005 "Eurodomest"
 #define EURODOMEST_PulseLength 50
+#define PLUGIN_PULSES_005 {EURODOMEST_PulseLength, EURODOMEST_PulseLength}
 
 #define EURODOMEST_PULSEMID_D 400
 #define EURODOMEST_PULSEMIN_D 100
@@ -53,7 +54,7 @@ boolean Plugin_005(byte function, const char *string)
 {
    if (RawSignal.Number != EURODOMEST_PulseLength)
       return false;
-   if (RawSignal.Pulses[0] == 63)
+   if (DispatchResult.routeHint == 63)
       return false; // No need to test, packet for plugin 63
 
    const long EURODOMEST_PULSEMID = EURODOMEST_PULSEMID_D / RawSignal.Multiply;
@@ -101,9 +102,7 @@ boolean Plugin_005(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform more sanity checks to prevent false positives
@@ -139,8 +138,6 @@ boolean Plugin_005(byte function, const char *string)
    display_Footer();
 
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif //PLUGIN_005
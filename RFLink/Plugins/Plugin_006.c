@@ -38,6 +38,7 @@
 #define BLYSS_PLUGIN_ID 006
 #define PLUGIN_DESC_006 "Blyss / Avidsen"
 #define BLYSS_PULSECOUNT 106
+#define PLUGIN_PULSES_006 {BLYSS_PULSECOUNT, BLYSS_PULSECOUNT}
 #define BLYSS_PULSEMID_D 500
 
 #ifdef PLUGIN_006
@@ -97,9 +98,7 @@ boolean Plugin_006(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream;   // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    byte status = ((bitstream1) >> 16) & 0x0f;
@@ -146,8 +145,6 @@ boolean Plugin_006(byte function, const char *string)
    display_CMD((status >> 1) & B01, !(status & B01)); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_006
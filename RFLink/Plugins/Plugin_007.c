@@ -45,6 +45,7 @@
 #define CONRADRSL2_PLUGIN_ID 007
 #define PLUGIN_DESC_007 "Conrad"
 #define CONRADRSL2_PULSECOUNT 66
+#define PLUGIN_PULSES_007 {CONRADRSL2_PULSECOUNT, CONRADRSL2_PULSECOUNT}, {CONRADRSL2_PULSECOUNT + 2, CONRADRSL2_PULSECOUNT + 2}
 
 #define CONRADRSL2_PULSEMID_D 600
 
@@ -96,9 +97,7 @@ boolean Plugin_007(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // all bits received, make sure checksum is okay
@@ -234,8 +233,6 @@ boolean Plugin_007(byte function, const char *string)
    display_CMD((group == 0x3), (action == 1)); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_007
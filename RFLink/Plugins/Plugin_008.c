@@ -34,6 +34,7 @@
 #define KAMBROOK_PLUGIN_ID 008
 #define PLUGIN_DESC_008 "Kambrook"
 #define KAMBROOK_PULSECOUNT 96
+#define PLUGIN_PULSES_008 {KAMBROOK_PULSECOUNT, KAMBROOK_PULSECOUNT}
 
 #define KAMBROOK_PULSEMID_D 400
 
@@ -117,11 +118,7 @@ boolean Plugin_008(byte function, const char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if (SignalHash != SignalHashPrevious || RepeatingTimer < millis())
-    {
-        // not seen the RF packet recently
-    }
-    else
+    if (RepeatCache::isRepeat(address, command))
         return true; // already seen the RF packet recently
     //==================================================================================
     //==================================================================================
@@ -147,8 +144,6 @@ boolean Plugin_008(byte function, const char *string)
     display_CMD(CMD_Single, (status & B01)); // #ALL #ON
     display_Footer();
     //==================================================================================
-    RawSignal.Repeats = true; // suppress repeats of the same RF packet
-    RawSignal.Number = 0;
     return true;
 }
 #endif // PLUGIN_008
@@ -46,6 +46,7 @@
 #define X10_PLUGIN_ID 009
 #define PLUGIN_DESC_009 "X10"
 #define X10_PulseLength 66
+#define PLUGIN_PULSES_009 {X10_PulseLength, X10_PulseLength}, {X10_PulseLength + 2, X10_PulseLength + 2}
 
 #define X10_PULSEMID_D 600
 
@@ -92,9 +93,7 @@ boolean Plugin_009(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    // order received data
@@ -281,8 +280,6 @@ boolean Plugin_009(byte function, const char *string)
    }
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif //PLUGIN_009
@@ -49,6 +49,7 @@
 #define PLUGIN_DESC_010 "TRC02RGB"
 #define RGB_MIN_PULSECOUNT 180
 #define RGB_MAX_PULSECOUNT 186
+#define PLUGIN_PULSES_010 {RGB_MIN_PULSECOUNT, RGB_MAX_PULSECOUNT}
 
 #define RGB_PULSE_STHI_D 1600
 #define RGB_PULSE_STLO_D 1300
@@ -219,8 +220,6 @@ boolean Plugin_010(byte function, const char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_010
@@ -81,6 +81,7 @@
 #define HC_PLUGIN_ID 011
 #define PLUGIN_DESC_011 "HomeConfort"
 #define HC_PULSECOUNT 100
+#define PLUGIN_PULSES_011 {HC_PULSECOUNT, HC_PULSECOUNT}
 #define HC_PULSE_PREAMBLE_D 2400
 #define HC_PULSE_MID_D 500
 #define HC_PULSE_MAX_D 800
@@ -149,9 +150,7 @@ boolean Plugin_011(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || ((RepeatingTimer + 500) < millis()) || SignalCRC != bitstream2)
-      SignalCRC = bitstream2; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream2, 500))
       return true; // already seen the RF packet recently
 
    //==================================================================================
@@ -216,8 +215,6 @@ boolean Plugin_011(byte function, const char *string)
    else // Unknow protocol or function
       return false;
        
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_011
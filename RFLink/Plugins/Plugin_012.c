@@ -80,6 +80,7 @@
 #define PLUGIN_DESC_012 "FA500"
 #define FA500RM3_PulseLength 26
 #define FA500RM1_PulseLength 58
+#define PLUGIN_PULSES_012 {FA500RM3_PulseLength, FA500RM3_PulseLength}, {FA500RM1_PulseLength, FA500RM1_PulseLength}
 
 #define FA500_PULSEMID_D 400
 
@@ -233,7 +234,6 @@ boolean Plugin_012(byte function, const char *string)
    }
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
    return true;
 }
 #endif //PLUGIN_012
@@ -91,6 +91,7 @@
 #define POWERFIX_PLUGIN_ID 013
 #define PLUGIN_DESC_013 "Powerfix"
 #define POWERFIX_PulseLength 42
+#define PLUGIN_PULSES_013 {POWERFIX_PulseLength, POWERFIX_PulseLength}
 
 #define POWEFIX_PULSEMID_D 900
 #define POWEFIX_PULSEMIN_D 450
@@ -157,9 +158,7 @@ boolean Plugin_013(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || (RepeatingTimer < millis() + 1500) || SignalCRC != bitstream)
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 1500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Sort data
@@ -209,8 +208,6 @@ boolean Plugin_013(byte function, const char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 
@@ -37,6 +37,7 @@
 #define PLUGIN_DESC_014 "Ikea Koppla"
 #define KOPPLA_PulseLength_MIN 36
 #define KOPPLA_PulseLength_MAX 52
+#define PLUGIN_PULSES_014 {KOPPLA_PulseLength_MIN, KOPPLA_PulseLength_MAX}
 
 #define KOPPLA_PULSEMID_D 1300
 #define KOPPLA_PULSEMAX_D 1850
@@ -173,8 +174,6 @@ boolean Plugin_014(byte function, const char *string)
    }
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif //PLUGIN_014
@@ -50,6 +50,7 @@
 #define HomeEasy_PLUGIN_ID 015
 #define PLUGIN_DESC_015 "HomeEasy"
 #define HomeEasy_PulseLength 116
+#define PLUGIN_PULSES_015 {HomeEasy_PulseLength, HomeEasy_PulseLength}
 
 #define HomeEasy_PULSEMID_D 500
 
@@ -72,7 +73,7 @@ boolean Plugin_015(byte function, const char *string)
    byte channel = 0;
    byte type = 0;
    byte temp = 0;
-   RawSignal.Pulses[0] = 0; // undo any Home Easy to Kaku blocking that might be active
+   DispatchResult.routeHint = 0; // undo any Home Easy to Kaku blocking that might be active
    //==================================================================================
    // Get all 58? bits
    //==================================================================================
@@ -103,9 +104,7 @@ boolean Plugin_015(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if (SignalHash != SignalHashPrevious || (RepeatingTimer < millis() + 500) || SignalCRC != bitstream)
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    type = ((bitstream >> 12) & 0x3); // 11b for HE301
@@ -134,8 +133,6 @@ boolean Plugin_015(byte function, const char *string)
    display_CMD((group & B01), (!(command & B01))); // #All #ON
    display_Footer();
    // ----------------------------------
-   RawSignal.Repeats = true;
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_015
@@ -34,11 +34,12 @@ static const uint16_t * SLVCR_Codes(int remoteId, boolean bOn)
    }
 }
 
+#define SLVCR_MinPulses 180
+#define SLVCR_MaxPulses 320
+#define PLUGIN_PULSES_016 {SLVCR_MinPulses, SLVCR_MaxPulses}
+
 boolean Plugin_016(byte function, const char *string)
 {
-   const int SLVCR_MinPulses = 180;
-   const int SLVCR_MaxPulses = 320;
-
    if (RawSignal.Number >= SLVCR_MinPulses && RawSignal.Number <= SLVCR_MaxPulses) 
    {
       const int SLVCR_StartPulseDuration = 2000 / RawSignal.Multiply;
@@ -65,14 +66,16 @@ boolean Plugin_016(byte function, const char *string)
       {
          // found start pulse followed by at least 24 bits (2 pulses per bit)
          pulseIndex++;
-         uint8_t packet[SLVCR_BitCount / 8] = {0, 0, 0};
-         if (!decode_pwm(packet, SLVCR_BitCount, RawSignal.Pulses, RawSignal.Number, pulseIndex, SLVCR_ShortPulseMinDuration, SLVCR_ShortPulseMaxDuration, SLVCR_LongPulseMinDuration, SLVCR_LongPulseMaxDuration))   
+         uint32_t bits = 0;
+         PulseThresholds thresholds(SLVCR_ShortPulseMinDuration, SLVCR_ShortPulseMaxDuration, SLVCR_LongPulseMinDuration, SLVCR_LongPulseMaxDuration);
+         if (slice_pwm(&bits, SLVCR_BitCount, RawSignal.Pulses, RawSignal.Number + 1, pulseIndex, thresholds).bitCount != SLVCR_BitCount)
          {
             #ifdef PLUGIN_016_DEBUG
             Serial.println(F(PLUGIN_016_ID ": Could not decode PWM!"));
             #endif
             return false;
          }
+         uint8_t packet[SLVCR_BitCount / 8] = {(uint8_t)(bits >> 24), (uint8_t)(bits >> 16), (uint8_t)(bits >> 8)};
 
          {
             const size_t buflen = sizeof(PLUGIN_016_ID ": packet = ") + 7;
@@ -132,7 +135,6 @@ boolean Plugin_016(byte function, const char *string)
          display_SWITCH(buttonId); // button Id
          display_CMD(false, command);
          display_Footer();
-         RawSignal.Repeats = true; // suppress repeats of the same RF packet
          return true;
       }
       else
@@ -51,11 +51,12 @@ const int RTS_SoftwareSyncPulseDurationBase = 4500;
 // Avoid copy/paste, but use a define to prevent the computation from occuring at boot time, we want it to occur when the method is called
 #define DeclareRTS_SoftwareSyncPulseDuration const int RTS_SoftwareSyncPulseDuration = RTS_SoftwareSyncPulseDurationBase / RawSignal.Multiply;
 
+#define RTS_MinPulses 85
+#define RTS_MaxPulses 105
+#define PLUGIN_PULSES_017 {RTS_MinPulses, RTS_MaxPulses}
+
 boolean Plugin_017(byte function, const char *string)
 {
-    const int RTS_MinPulses = 85;
-    const int RTS_MaxPulses = 105;
-
    // ;Pulses=82;Pulses(uSec)=2449,2542,4787,1299,1264,674,612,1311,1263,1301,1261,666,608,1315,1255,683,610,663,615,679,611,1299,1263,1307,611,679,1263,663,611,1309,610,666,1255,1315,1255,682,606,1316,611,665,605,678,1248,679,611,1310,1259,1300,611,679,1259,1311,1259,1311,1263,675,603,679,611,1311,1259,667,611,1311,1259,1311,611,667,611,679,611,667,612,678,1247,1315,608,678,600,678,1260,0
 
    if (RawSignal.Number >= RTS_MinPulses && RawSignal.Number <= RTS_MaxPulses) 
@@ -67,6 +68,9 @@ boolean Plugin_017(byte function, const char *string)
         DeclareRTS_SoftwareSyncPulseDuration;
         const int RTS_MinRepeatHardwareSyncCount = 5;
 
+        if (FrameFeatures.maxPulse < RTS_SoftwareSyncPulseDuration)
+            return false; // no software sync pulse in this frame, no need to look for it
+
         #ifdef PLUGIN_017_DEBUG
         Serial.println(F(PLUGIN_017_ID ": Potential candidate packet"));
         Serial.print(F(PLUGIN_017_ID ": RTS_SoftwareSyncPulseDuration = "));
@@ -186,14 +190,19 @@ boolean Plugin_017(byte function, const char *string)
         }
 
         pulseIndex++;
-        uint8_t frame[RTS_ExpectedByteCount] = {0, 0, 0, 0, 0, 0, 0};
-        if (!decode_manchester(frame, RTS_ExpectedBitCount, RawSignal.Pulses, RawSignal.Number, pulseIndex, nextBit, secondPulse, RTS_ShortPulseMinDuration, RTS_ShortPulseMaxDuration))
+        uint32_t words[(RTS_ExpectedBitCount + 31) / 32];
+        PulseThresholds thresholds(RTS_ShortPulseMinDuration, RTS_ShortPulseMaxDuration, RTS_ShortPulseMinDuration * 2, RTS_ShortPulseMaxDuration * 2);
+        SliceResult sliced = slice_manchester(words, RTS_ExpectedBitCount, RawSignal.Pulses, RawSignal.Number, pulseIndex, nextBit, secondPulse, thresholds);
+        if (sliced.bitCount != RTS_ExpectedBitCount)
         {
             #ifdef PLUGIN_017_DEBUG
-            Serial.println(F(PLUGIN_017_ID ": Could not decode Manchester data"));
+            Serial.print(F(PLUGIN_017_ID ": Could not decode Manchester data, stopped at pulse "));
+            Serial.println(sliced.stopIndex);
             #endif
             return false;
         }
+        uint8_t frame[RTS_ExpectedByteCount];
+        unpack_words(frame, 0, words, RTS_ExpectedBitCount);
 
         #ifdef PLUGIN_017_DEBUG
         Serial.print(F(PLUGIN_017_ID ": Frame = "));
@@ -327,7 +336,6 @@ boolean Plugin_017(byte function, const char *string)
         display_IDn(rollingCode, 4);  
         display_CMD(false, command);
         display_Footer();
-        RawSignal.Repeats = true; // suppress repeats of the same RF packet
         return true;
     }
     return false;
@@ -39,11 +39,12 @@
  * 270,674,255,675,262,271,661,665,269,271,659,660,275,668,265,273,663,649,5000;RSSI=-9999;REASON=Unknown
 */
 
+#define LOUVO_PULSECOUNT 130
+#define PLUGIN_PULSES_018 {LOUVO_PULSECOUNT, LOUVO_PULSECOUNT}
+
 boolean Plugin_018(byte function, const char *string)
 {
-    const int ExpectedPulses = 130;
-
-    if (RawSignal.Number == ExpectedPulses)
+    if (RawSignal.Number == LOUVO_PULSECOUNT)
     {
         const int PWMShortMin = (LOUVO_PWM_SHORT - LOUVO_PWM_TOLERANCE) / RawSignal.Multiply;
         const int PWMShortMax = (LOUVO_PWM_SHORT + LOUVO_PWM_TOLERANCE) / RawSignal.Multiply;
@@ -59,11 +60,15 @@ boolean Plugin_018(byte function, const char *string)
         byte packet[LOUVO_BYTE_COUNT] = {0};
 
         //Skip the first bit as the lengths tend to vary...
-        if(!decode_pwm(packet, 65, RawSignal.Pulses, RawSignal.Number, 1, PWMShortMin, PWMShortMax, PWMLongMin, PWMLongMax, 0))
+        uint32_t words[(65 + 31) / 32];
+        PulseThresholds thresholds(PWMShortMin, PWMShortMax, PWMLongMin, PWMLongMax);
+        SliceResult sliced = slice_pwm(words, 65, RawSignal.Pulses, RawSignal.Number + 1, 1, thresholds);
+        if (sliced.bitCount != 65)
         {
             Serial.println(F(PLUGIN_018_ID ": Failed to decode PWM"));
             return false;
         }
+        unpack_words(packet, 0, words, 65);
 
         if (packet[0] == pkt_header)
         {
@@ -113,7 +118,6 @@ boolean Plugin_018(byte function, const char *string)
         display_CMD(false, pkt_cmd);
         display_Footer();
 
-        RawSignal.Repeats = true; // suppress repeats of the same RF packet
         return true;
     }
     return false;
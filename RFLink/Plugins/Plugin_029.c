@@ -56,6 +56,7 @@
 #define ACH2010_MAX_PULSECOUNT 160
 #define DKW2012_MIN_PULSECOUNT 170
 #define DKW2012_MAX_PULSECOUNT 178
+#define PLUGIN_PULSES_029 {ACH2010_MIN_PULSECOUNT, ACH2010_MAX_PULSECOUNT}, {DKW2012_MIN_PULSECOUNT, DKW2012_MAX_PULSECOUNT}
 
 #define DKW2012_PULSEMINMAX_D 768
 
@@ -69,7 +70,7 @@
  *           http://lucsmall.com/2012/04/30/weather-station-hacking-part-3/
  *           https://github.com/lucsmall/WH2-Weather-Sensor-Library-for-Arduino/blob/master/WeatherSensorWH2.cpp
  \*********************************************************************************************/
-#define Plugin_029_ProtocolAlectoCRC8(addr, len) crc8((addr), (len), 0x31, 0)
+#define Plugin_029_ProtocolAlectoCRC8(addr, len) crc8_table<0x31>((addr), (len), 0)
 
 boolean Plugin_029(byte function, const char *string)
 {
@@ -130,9 +131,7 @@ boolean Plugin_029(byte function, const char *string)
   //==================================================================================
   unsigned long tmpval = data[0] << 8 | data[1];
 
-  if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || (SignalCRC != tmpval))
-    SignalCRC = tmpval; // not seen the RF packet recently
-  else
+  if (RepeatCache::isRepeat(0, tmpval, 1000))
     return true; // already seen the RF packet recently
   //==================================================================================
   // Now process the various sensor types
@@ -182,8 +181,6 @@ boolean Plugin_029(byte function, const char *string)
   display_BAT(bat);
   display_Footer();
   //==================================================================================
-  RawSignal.Repeats = true; // suppress repeats of the same RF packet
-  RawSignal.Number = 0;     // do not process the packet any further
   return true;
 }
 
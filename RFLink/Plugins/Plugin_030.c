@@ -95,6 +95,7 @@
 #define ALECTOV1_PLUGIN_ID 030
 #define PLUGIN_DESC_030 "Alecto V1"
 #define ALECTOV1_PULSECOUNT 74
+#define PLUGIN_PULSES_030 {ALECTOV1_PULSECOUNT, ALECTOV1_PULSECOUNT}
 
 #define ALECTOV1_MIDHI_D 700
 #define ALECTOV1_PULSEMAXMIN_D 2560
@@ -205,12 +206,7 @@ boolean Plugin_030(byte function, const char *string)
                        //==================================================================================
       // Prevent repeating signals from showing up
       //==================================================================================
-      if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || ((SignalCRC != bitstream) && (SignalCRC_1 != bitstream)))
-      {
-         SignalCRC_1 = SignalCRC; // for mixed message burst prevention
-         SignalCRC = bitstream;   // not seen the RF packet recently
-      }
-      else
+      if (RepeatCache::isRepeat(0, bitstream, 1000))
          return true; // already seen the RF packet recently
       //==================================================================================
       // Output
@@ -224,8 +220,6 @@ boolean Plugin_030(byte function, const char *string)
       display_BAT(battery);
       display_Footer();
       //==================================================================================
-      RawSignal.Repeats = true; // suppress repeats of the same RF packet
-      RawSignal.Number = 0;
       return true;
    }
    else
@@ -233,12 +227,7 @@ boolean Plugin_030(byte function, const char *string)
       //==================================================================================
       // Prevent repeating signals from showing up
       //==================================================================================
-      if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 1000 < millis()) || ((SignalCRC != bitstream) && (SignalCRC_1 != bitstream)))
-      {
-         SignalCRC_1 = SignalCRC; // for mixed message burst prevention
-         SignalCRC = bitstream;   // not seen the RF packet recently
-      }
-      else
+      if (RepeatCache::isRepeat(0, bitstream, 1000))
          return true; // already seen the RF packet recently
       display_Header();
       display_Name(PSTR("Alecto V1"));
@@ -276,8 +265,6 @@ boolean Plugin_030(byte function, const char *string)
       display_BAT(battery);
       display_Footer();
       //==================================================================================
-      RawSignal.Repeats = true; // suppress repeats of the same RF packet
-      RawSignal.Number = 0;
       return true;
    }
    return false;
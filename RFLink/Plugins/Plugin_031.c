@@ -67,6 +67,7 @@
 #define PLUGIN_DESC_031 "Alecto V3"
 #define WS1100_PULSECOUNT 94
 #define WS1200_PULSECOUNT 126
+#define PLUGIN_PULSES_031 {WS1100_PULSECOUNT, WS1100_PULSECOUNT}, {WS1200_PULSECOUNT, WS1200_PULSECOUNT}
 
 #define ALECTOV3_PULSEMID_D 300
 
@@ -80,7 +81,7 @@
  *           http://lucsmall.com/2012/04/30/weather-station-hacking-part-3/
  *           https://github.com/lucsmall/WH2-Weather-Sensor-Library-for-Arduino/blob/master/WeatherSensorWH2.cpp
  \*********************************************************************************************/
-#define Plugin_031_ProtocolAlectoCRC8(addr, len) crc8((addr), (len), 0x31, 0)
+#define Plugin_031_ProtocolAlectoCRC8(addr, len) crc8_table<0x31>((addr), (len), 0)
 
 // unsigned int Plugin_031_ProtocolAlectoRainBase = 0;
 
@@ -112,9 +113,9 @@ boolean Plugin_031(byte function, const char *string)
       //    bitstream1 |= 0x0;
    }
    for (byte x = 79; x <= 141; x = x + 2)
-   {                    // get second 32 relevant bits
+   {                    // get second 32 relevant bits, WS1100 frames end after the checksum byte
       bitstream2 <<= 1; // Always shift
-      if (RawSignal.Pulses[x] < ALECTOV3_PULSEMID)
+      if (x <= RawSignal.Number && RawSignal.Pulses[x] < ALECTOV3_PULSEMID)
          bitstream2 |= 0x1;
       // else
       //    bitstream2 |= 0x0;
@@ -191,8 +192,6 @@ boolean Plugin_031(byte function, const char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;     // do not process the packet any further
    return true;
 }
 
@@ -42,6 +42,7 @@
 #define ALECTOV4_PLUGIN_ID 032
 #define PLUGIN_DESC_032 "Alecto V4"
 #define ALECTOV4_PULSECOUNT 74
+#define PLUGIN_PULSES_032 {ALECTOV4_PULSECOUNT, ALECTOV4_PULSECOUNT + 4}
 
 #define ALECTOV4_MIDHI_D 550
 #define ALECTOV4_PULSEMIN_D 1500
@@ -152,9 +153,7 @@ boolean Plugin_032(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (((bitstream << 8) & 0xFFF0) | humidity); // All but 8 1st ID bits ...
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, tmpval, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -170,8 +169,6 @@ boolean Plugin_032(byte function, const char *string)
    display_BAT(battery);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_032
@@ -34,6 +34,7 @@
 #define CONRAD_PLUGIN_ID 033
 #define PLUGIN_DESC_033 "Conrad"
 #define CONRAD_PULSECOUNT 80
+#define PLUGIN_PULSES_033 {CONRAD_PULSECOUNT, CONRAD_PULSECOUNT}
 
 #define CONRAD_PULSEMAX_D 5000
 #define CONRAD_PULSEMIN_D 2300
@@ -96,9 +97,7 @@ boolean Plugin_033(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -121,8 +120,6 @@ boolean Plugin_033(byte function, const char *string)
    display_TEMP(temperature);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_033
@@ -30,6 +30,7 @@
 
 #define CRESTA_MIN_PULSECOUNT 124 // unknown until we have a collection of all packet types but this seems to be the minimum
 #define CRESTA_MAX_PULSECOUNT 284 // unknown until we have a collection of all packet types
+#define PLUGIN_PULSES_034 {CRESTA_MIN_PULSECOUNT, CRESTA_MAX_PULSECOUNT}
 
 #define CRESTA_PULSEMID_D 700
 
@@ -205,9 +206,7 @@ boolean Plugin_034(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = ((unsigned long)data[3] << 16) | ((data[1]) << 8) | channel;
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, tmpval, 500))
       return true; // already seen the RF packet recently
    // ----------------------------------
    battery = !((data[2]) >> 6);
@@ -354,8 +353,6 @@ boolean Plugin_034(byte function, const char *string)
       Serial.println();
       //==================================================================================
    }
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 
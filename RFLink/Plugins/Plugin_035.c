@@ -40,6 +40,7 @@
 #define PLUGIN_DESC_035 "Imagintronix"
 
 #define IMAGINTRONIX_PULSECOUNT 96
+#define PLUGIN_PULSES_035 {IMAGINTRONIX_PULSECOUNT, IMAGINTRONIX_PULSECOUNT}
 
 #define IMAGINTRONIX_PULSEMID_D 100
 #define IMAGINTRONIX_PULSESHORT_D 550
@@ -117,9 +118,7 @@ boolean Plugin_035(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    rc = (data[1]) & 0x3;
@@ -135,8 +134,6 @@ boolean Plugin_035(byte function, const char *string)
    display_HUM(data[2]);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_035
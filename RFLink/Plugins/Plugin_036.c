@@ -33,6 +33,7 @@
 #define F007_TH_PLUGIN_ID 036
 #define PLUGIN_DESC_036 "F007_TH"
 #define F007_TH_PULSECOUNT 111
+#define PLUGIN_PULSES_036 {F007_TH_PULSECOUNT, F007_TH_PULSECOUNT}
 
 #define F007_TH_PULSE_MID_D  650
 
@@ -92,9 +93,7 @@ boolean Plugin_036(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer) + 700 < millis()) || (SignalCRC != datastream))
-      SignalCRC = datastream;
-   else
+   if (RepeatCache::isRepeat(0, datastream, 700))
       return true; // packet already seen
 
    //==================================================================================
@@ -122,8 +121,6 @@ boolean Plugin_036(byte function, const char *string)
    display_Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // Plugin_036
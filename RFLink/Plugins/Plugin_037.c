@@ -41,6 +41,7 @@
 #define ACURITE_PLUGIN_ID 037
 #define PLUGIN_DESC_037 "AcuRite 986"
 #define ACURITE_PULSECOUNT 84
+#define PLUGIN_PULSES_037 {ACURITE_PULSECOUNT, ACURITE_PULSECOUNT + 4}
 
 #define ACURITE_MIDHI_D 2000
 #define ACURITE_PULSEMIN_D 150
@@ -127,7 +128,7 @@ boolean Plugin_037(byte function, const char *string)
    //==================================================================================
    // CRC Check
    //==================================================================================
-   crcc = crc8le(data, 4, 0x07, 0);
+   crcc = crc8le_table<0x07>(data, 4, 0);
    if (crcc != reverse8(bitstream2))
    {
       //Serial.println("ERROR: crc failed.");
@@ -174,9 +175,7 @@ boolean Plugin_037(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (((bitstream << 8) & 0xFFF0)); // All but 8 1st ID bits ...
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, tmpval, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -190,8 +189,6 @@ boolean Plugin_037(byte function, const char *string)
    display_BAT(battery);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_037
@@ -47,6 +47,7 @@
 #define MEBUS_PLUGIN_ID 040
 #define PLUGIN_DESC_040 "Mebus"
 #define MEBUS_PULSECOUNT 58
+#define PLUGIN_PULSES_040 {MEBUS_PULSECOUNT, MEBUS_PULSECOUNT}
 
 #define MEBUS_MIDHI_D 550
 #define MEBUS_PULSEMIN_D 1500
@@ -117,9 +118,7 @@ boolean Plugin_040(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 150 < millis() && SignalCRC != bitstream) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 150))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Prepare nibbles from bit stream
@@ -177,8 +176,6 @@ boolean Plugin_040(byte function, const char *string)
    display_TEMP(temperature);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_040
@@ -86,6 +86,7 @@
 #define LACROSSE41_PULSECOUNT2 162 // Meteo sensor
 #define LACROSSE41_PULSECOUNT3 122 // Wind sensor
 #define LACROSSE41_PULSECOUNT4 132 // Brightness sensor
+#define PLUGIN_PULSES_041 {LACROSSE41_PULSECOUNT1, LACROSSE41_PULSECOUNT1}, {LACROSSE41_PULSECOUNT2, LACROSSE41_PULSECOUNT2}, {LACROSSE41_PULSECOUNT3, LACROSSE41_PULSECOUNT3}, {LACROSSE41_PULSECOUNT4, LACROSSE41_PULSECOUNT4}
 
 #define LACROSSE41_PULSEMID_D 500
 
@@ -166,9 +167,7 @@ boolean Plugin_041(byte function, const char *string)
    //==================================================================================
    unsigned long tempval = (((unsigned long)(data[4]) >> 1) << 16) | ((data[3]) << 8) | data[2];
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 150) < millis()) || (SignalCRC != tempval))
-      SignalCRC = tempval; // not seen this RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, tempval, 150))
       return true; // already seen the RF packet recently, but still want the humidity
    //==================================================================================
    // now process the various sensor types
@@ -228,8 +227,6 @@ boolean Plugin_041(byte function, const char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true;
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_041
@@ -92,6 +92,7 @@
 
 #define UPM_MIN_PULSECOUNT 46
 #define UPM_MAX_PULSECOUNT 56
+#define PLUGIN_PULSES_042 {UPM_MIN_PULSECOUNT, UPM_MAX_PULSECOUNT}
 
 #define UPM_PULSELOHI_D 1175
 #define UPM_PULSEHIHI_D 2075
@@ -211,9 +212,7 @@ boolean Plugin_042(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream1))
-      SignalCRC = bitstream1; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream1, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // now process the various sensor types
@@ -310,8 +309,6 @@ boolean Plugin_042(byte function, const char *string)
    display_BAT(battery);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_042
@@ -91,6 +91,7 @@
 #define PLUGIN_DESC_043 "LaCrosse"
 
 #define LACROSSE43_PULSECOUNT 88 // also handles 84 to 92 pulses!
+#define PLUGIN_PULSES_043 {LACROSSE43_PULSECOUNT - 4, LACROSSE43_PULSECOUNT + 4}
 
 #define LACROSSE43_MIDLO_D 640
 #define LACROSSE43_MIDHI_D 1056
@@ -126,19 +127,20 @@ boolean Plugin_043(byte function, const char *string)
    //==================================================================================
    for (byte x = 1; x < RawSignal.Number; x += 2)
    {
+      unsigned int pulse = RawSignal.Pulses[x];
       if ((RawSignal.Pulses[x + 1] < LACROSSE43_MIDLO) || (RawSignal.Pulses[x + 1] > LACROSSE43_MIDHI))
       {
          if (x == 1) // Make sure the first bit is correct..
-            RawSignal.Pulses[1] = LACROSSE43_PULSEMAX - 1;
+            pulse = LACROSSE43_PULSEMAX - 1;
          else
          {
             if ((x + 1) < RawSignal.Number) // in between pulse check
                return false;
          }
       }
-      if (RawSignal.Pulses[x] > LACROSSE43_PULSEMAXMIN)
+      if (pulse > LACROSSE43_PULSEMAXMIN)
       {
-         if ((RawSignal.Pulses[x] > LACROSSE43_PULSEMAX) && (x > 1))
+         if ((pulse > LACROSSE43_PULSEMAX) && (x > 1))
             return false;
 
          if (bitcounter < 20)
@@ -151,7 +153,7 @@ boolean Plugin_043(byte function, const char *string)
       }
       else
       {
-         if (RawSignal.Pulses[x] > LACROSSE43_PULSEMINMAX)
+         if (pulse > LACROSSE43_PULSEMINMAX)
             return false;
 
          if (bitcounter < 20)
@@ -210,9 +212,7 @@ boolean Plugin_043(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 4) | (data[10]); // sensor type + ID + checksum
 
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, tmpval))
       return true; // already seen the RF packet recently, but still want the humidity
    //==================================================================================
    // now process the various sensor types
@@ -235,8 +235,6 @@ boolean Plugin_043(byte function, const char *string)
       display_TEMP(temperature);
       display_Footer();
       //==================================================================================
-      RawSignal.Repeats = false;
-      RawSignal.Number = 0;
       return true;
    }
    else if (data[2] == 0xE)
@@ -255,8 +253,6 @@ boolean Plugin_043(byte function, const char *string)
       display_HUM(humidity);
       display_Footer();
       //==================================================================================
-      RawSignal.Repeats = true;
-      RawSignal.Number = 0;
       return true;
    }
    else
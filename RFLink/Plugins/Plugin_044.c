@@ -37,6 +37,7 @@
 #define AURIOLV3_PLUGIN_ID 044
 #define PLUGIN_DESC_044 "Auriol V3"
 #define AURIOLV3_PULSECOUNT 82
+#define PLUGIN_PULSES_044 {AURIOLV3_PULSECOUNT, AURIOLV3_PULSECOUNT}
 
 #define AURIOLV3_MIDHI_D 650
 
@@ -55,7 +56,7 @@ static int crc_check(uint8_t *b) {
   // for CRC computation, channel bits are at the CRC position(!)
   msg[1] = (msg[1] & 0x0F) | (msg[4] & 0x0F) << 4;
   // crc4() only works with full bytes
-  crc = crc4(msg, 4, 0x13, 0); // Koopmann 0x9, CCITT-4; FP-4; ITU-T G.704
+  crc = crc4_table<0x13>(msg, 4, 0); // Koopmann 0x9, CCITT-4; FP-4; ITU-T G.704
   crc ^= msg[4] >> 4;          // last nibble is only XORed
   return (crc == msg_crc);
 }
@@ -118,29 +119,24 @@ boolean Plugin_044(byte function, const char *string)
    //==================================================================================
    // Perform sanity checks and prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer < millis()))
-   {
-      if (bitstream1 == 0)
-         return false; // not seen the RF packet recently
-      if (bitstream2 == 0)
-         return false;
+   if (bitstream1 == 0)
+      return false;
+   if (bitstream2 == 0)
+      return false;
 
-      uint8_t data[5] = {
-          (uint8_t)((bitstream1 >> 8) & 0xFF),
-          (uint8_t)(bitstream1 & 0xFF),
-          (uint8_t)((bitstream2 >> 16) & 0xFF),
-          (uint8_t)((bitstream2 >> 8) & 0xFF),
-          (uint8_t)(bitstream2 & 0xFF),
-      };
-      if (crc_check(data) == false) {
-         // CRC error
-         return false;
-      }
+   uint8_t data[5] = {
+       (uint8_t)((bitstream1 >> 8) & 0xFF),
+       (uint8_t)(bitstream1 & 0xFF),
+       (uint8_t)((bitstream2 >> 16) & 0xFF),
+       (uint8_t)((bitstream2 >> 8) & 0xFF),
+       (uint8_t)(bitstream2 & 0xFF),
+   };
+   if (crc_check(data) == false) {
+      // CRC error
+      return false;
    }
-   else
-   {
+   if (RepeatCache::isRepeat(bitstream1, bitstream2))
       return true; // already seen the RF packet recently
-   }
    //==================================================================================
    // now process sensor type
    //==================================================================================
@@ -186,8 +182,6 @@ boolean Plugin_044(byte function, const char *string)
    display_Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
 
    return true;
 }
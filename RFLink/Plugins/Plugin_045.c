@@ -35,6 +35,7 @@
 #define AURIOL_PLUGIN_ID 045
 #define PLUGIN_DESC_045 "Auriol"
 #define AURIOL_PULSECOUNT 66
+#define PLUGIN_PULSES_045 {AURIOL_PULSECOUNT, AURIOL_PULSECOUNT}
 
 #define AURIOL_MIDHI_D 550
 #define AURIOL_PULSEMIN_D 1600
@@ -112,9 +113,7 @@ boolean Plugin_045(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -170,8 +169,6 @@ boolean Plugin_045(byte function, const char *string)
    display_BAT(bat);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_045
@@ -48,6 +48,7 @@
 #define PLUGIN_DESC_046 "Auriol V2 / Xiron"
 
 #define AURIOLV2_PULSECOUNT 74
+#define PLUGIN_PULSES_046 {AURIOLV2_PULSECOUNT, AURIOLV2_PULSECOUNT}
 
 #define AURIOLV2_MIDHI_D 700
 #define AURIOLV2_PULSEMIN_D 500
@@ -130,9 +131,7 @@ boolean Plugin_046(byte function, const char *string)
    //==================================================================================
    unsigned long tmpval = (bitstream1 << 8) | (bitstream2 & 0xFF); // All but "1111" padded section
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != tmpval))
-      SignalCRC = tmpval; // not seen this RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, tmpval, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Now process the various sensor types
@@ -201,8 +200,6 @@ boolean Plugin_046(byte function, const char *string)
    display_CHAN(channel);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_046
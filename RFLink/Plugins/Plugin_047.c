@@ -35,6 +35,7 @@
 #define AURIOLV4_PLUGIN_ID 047
 #define PLUGIN_DESC_047 "Auriol V4"
 #define AURIOLV4_PULSECOUNT 88
+#define PLUGIN_PULSES_047 {AURIOLV4_PULSECOUNT - 4, AURIOLV4_PULSECOUNT + 2}
 
 #define AURIOLV4_MIDLO_D 128
 #define AURIOLV4_MIDHI_D 672
@@ -127,9 +128,7 @@ boolean Plugin_047(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 500 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Perform checksum calculations
@@ -142,7 +141,7 @@ boolean Plugin_047(byte function, const char *string)
    for (byte c = 0; c < 4; c++)
       checksumcalc ^= ((bitstream >> (8 * c)) & 0xFF);
 
-   if (checksum != crc8(&checksumcalc, 1, 0x31, 0x53))
+   if (checksum != crc8_table<0x31>(&checksumcalc, 1, 0x53))
       return false;
    //==================================================================================
    // now process the various sensor types
@@ -185,8 +184,6 @@ boolean Plugin_047(byte function, const char *string)
    display_BAT(bat);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_047
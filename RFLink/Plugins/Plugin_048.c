@@ -38,6 +38,7 @@
 
 #define OSV3_PULSECOUNT_MIN 50  // 126
 #define OSV3_PULSECOUNT_MAX RAW_BUFFER_SIZE
+#define PLUGIN_PULSES_048 {OSV3_PULSECOUNT_MIN, OSV3_PULSECOUNT_MAX}
 
 #ifdef PLUGIN_048
 #include "../4_Display.h"
@@ -528,12 +529,25 @@ byte checksum(byte type, int count, byte check)
    return 1;
 }
 
+// BCD temperature digits (nibbles 10, 11 and 8) followed by the sign nibble (13)
+typedef BitLayout<BitField<5*8, 4>, BitField<5*8 + 4, 4>, BitField<4*8, 4>, BitField<6*8 + 4, 4>> OregonTemperatureLayout;
+// humidity, high nibble then low nibble (nibbles 15 and 12)
+typedef BitLayout<BitField<7*8 + 4, 4>, BitField<6*8, 4>> OregonHumidityLayout;
+
 int oregon_getTemperature() {
-	int _t = ((osdata[5] >> 4) * 100) + ((osdata[5] & 0x0F) * 10) + ((osdata[4] >> 4) & 0x0f);
-	if ((osdata[6] & 0x0F) >= 8) _t = _t | 0x8000;
+	uint32_t digits[OregonTemperatureLayout::count];
+	OregonTemperatureLayout::extract(osdata, digits);
+	int _t = (digits[0] * 100) + (digits[1] * 10) + digits[2];
+	if (digits[3] >= 8) _t = _t | 0x8000;
 	return _t; /* 8312 => -21.3  | 0281 => 18.2 */
 }
 
+byte oregon_getHumidity(byte base) {
+	uint32_t digits[OregonHumidityLayout::count];
+	OregonHumidityLayout::extract(osdata, digits);
+	return (digits[0] * base) + digits[1];
+}
+
 unsigned long oregon_getRollingCodeAndChannel() {
 	return (((osdata[2] & 0x0F) + (osdata[3] & 0xF0)) << 8) | (osdata[2] >> 4); // A004 => RC A0, CH = 04 (1=1,2=2,4=3)
 }
@@ -574,7 +588,7 @@ boolean Plugin_048(byte function, const char *string) {
 #endif
 	
 	byte rc = 0;
-	unsigned int id = 1 == proto ? 0x0001 : (osdata[0] << 8) + (osdata[1]); // ID=XXXX;
+	unsigned int id = 1 == proto ? 0x0001 : BitField<0, 16>::get(osdata); // ID=XXXX;
 	int temp = 0;
 	byte hum = 0;
 	int comfort = 0;
@@ -656,7 +670,7 @@ boolean Plugin_048(byte function, const char *string) {
 		if (checksum(1, 8, osdata[8]) != 0) return false; // checksum = all nibbles 0-15 results is nibbles 16.17			 
 
 		temp = oregon_getTemperature();
-		hum = ((osdata[7] & 0x0F) * 16) + (osdata[6] >> 4);
+		hum = oregon_getHumidity(16);
 
 		display_Header();
 		display_NameEx(PSTR("Oregon"), id);
@@ -681,9 +695,8 @@ boolean Plugin_048(byte function, const char *string) {
 		0  1  2  3  4  5  6  7  8  9
 	*/
 
-		temp = ((osdata[5] >> 4) * 100) + ((osdata[5] & 0x0F) * 10) + ((osdata[4] >> 4));
-		if ((osdata[6] & 0x0F) >= 8) temp = temp | 0x8000;
-		hum = ((osdata[7] & 0x0F) * 10) + (osdata[6] >> 4);
+		temp = oregon_getTemperature();
+		hum = oregon_getHumidity(10);
 
 		// 0: normal, 4: comfortable, 8: dry, C: wet
 		int tmp_comfort = osdata[7] >> 4;
@@ -957,9 +970,6 @@ boolean Plugin_048(byte function, const char *string) {
 	}   
 #endif // PLUGIN_048_DEBUG_UNKNOWN
 
-	// suppress repeats of the same RF packet
-	RawSignal.Repeats = true;
-	RawSignal.Number = 0;
 
 	return true;
 }
@@ -91,6 +91,7 @@
 #define PLUGIN_DESC_049 "LaCrosse-TX141"
 
 #define LACROSSE49_MINPULSECOUNT 72 // signal  is repeated without a break so there is a high chance it will be seen a single very large message
+#define PLUGIN_PULSES_049 {LACROSSE49_MINPULSECOUNT, RAW_BUFFER_SIZE}
 #define LACROSSE49_PREAMBLE_PULSE_LENGTH_MIN_D 690
 #define LACROSSE49_PREAMBLE_PULSE_LENGTH_MAX_D 920
 
@@ -236,7 +237,7 @@ inline bool PLUGIN_049_decode(int fromPosition, int toPosition ) {
   }
 
   if (deviceType == LACROSSE_TX141W_BITLEN) {
-    if (crc8(data.storage, 8, 0x31, 0x00) ){
+    if (crc8_table<0x31>(data.storage, 8, 0x00) ){
       #ifdef PLUGIN_049_DEBUG
       sprintf(printBuf, PSTR("LACROSSE_TX141W Failed CRC"));
       sendRawPrint(printBuf, true);
@@ -244,15 +245,21 @@ inline bool PLUGIN_049_decode(int fromPosition, int toPosition ) {
       return false;
     }
 
-    uint32_t id = data.getUInt(0*8 + 5, 19);
+    // id, channel, battery low, type, temperature, humidity
+    typedef BitLayout<BitField<0*8 + 5, 19>, BitField<3*8 + 2, 2>, BitField<3*8 + 0, 1>,
+                      BitField<3*8 + 4, 4>, BitField<4*8, 12>, BitField<5*8 + 4, 12>> TX141WLayout;
+    uint32_t fields[TX141WLayout::count];
+    data.getFields<TX141WLayout>(fields);
+
+    uint32_t id = fields[0];
     display_IDn(id, 4);
 
-    display_CHAN(data.getUInt(3*8 + 2, 2));
+    display_CHAN(fields[1]);
 
-    bool battery_low = data.getUInt(3*8 + 0, 1);
-    uint8_t type = data.getUInt(3*8 + 4, 4);
-    int16_t temp_raw = (int16_t)data.getUInt(4*8, 12);
-    uint8_t humidity = data.getUInt(5*8 + 4, 12);
+    bool battery_low = fields[2];
+    uint8_t type = fields[3];
+    int16_t temp_raw = (int16_t)fields[4];
+    uint8_t humidity = fields[5];
 
 
     if (type == 1) {
@@ -281,12 +288,16 @@ inline bool PLUGIN_049_decode(int fromPosition, int toPosition ) {
     return true;
   }
   
-  // sensor ID
-  unsigned short int sensorId = data.getUInt(0, 8);
+  // sensor ID, battery, temperature
+  typedef BitLayout<BitField<0, 8>, BitField<8, 1>, BitField<12, 12>> TX141Layout;
+  uint32_t fields[TX141Layout::count];
+  data.getFields<TX141Layout>(fields);
+
+  unsigned short int sensorId = fields[0];
   display_IDn(sensorId, 4);
 
   // temperature reading
-  int16_t temperatureRaw = sensorId = data.getUInt(12, 12);;
+  int16_t temperatureRaw = fields[2];
 
 
   //Serial.printf("%.4X\r\n", (long int) temperatureRaw);
@@ -296,7 +307,7 @@ inline bool PLUGIN_049_decode(int fromPosition, int toPosition ) {
   display_TEMP(temperatureRaw);
 
   // battery status
-  display_BAT( (data.getBit(8)) ^ !(deviceType == LACROSSE_TX141_BITLEN || deviceType == LACROSSE_TX141BV3_BITLEN) );
+  display_BAT( (fields[1] != 0) ^ !(deviceType == LACROSSE_TX141_BITLEN || deviceType == LACROSSE_TX141BV3_BITLEN) );
 
   display_Footer();
 
@@ -357,8 +368,6 @@ boolean Plugin_049(byte function, const char *string) {
     if(PLUGIN_049_decode(preamblePosition, secondPreamblePosition))
       return true;
 
-    pbuffer[0] = 0;
-
     startPosition = secondPreamblePosition;
 
     if((int)RawSignal.Number - startPosition < 72) {
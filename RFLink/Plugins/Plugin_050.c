@@ -36,6 +36,7 @@ Comment detailing protocol from rtl_433 project.
 #define PLUGIN_050_ID "FineOffset"
 
 #define FINEOFFSET_PULSE_COUNT 96
+#define PLUGIN_PULSES_050 {FINEOFFSET_PULSE_COUNT, FINEOFFSET_PULSE_COUNT}
 
 #ifdef PLUGIN_050_DEBUG
 #define SerialDebugActivated
@@ -51,10 +52,13 @@ boolean Plugin_050(byte function, const char *string)
         const int CM_ShortHighMaxDuration = 600 / RawSignal.Multiply;
         byte data[6] = {0, 0, 0, 0, 0, 0};
         //Skip the first bit as the lengths tend to vary...
-        if(!decode_pwm(data, 47, RawSignal.Pulses,RawSignal.Number, 3, CM_ShortHighMinDuration, CM_ShortHighMaxDuration, CM_LongLowMinDuration, CM_LongLowMaxDuration, 1))
+        uint32_t words[(47 + 31) / 32];
+        PulseThresholds thresholds(CM_ShortHighMinDuration, CM_ShortHighMaxDuration, CM_LongLowMinDuration, CM_LongLowMaxDuration);
+        if (slice_pwm(words, 47, RawSignal.Pulses, RawSignal.Number + 1, 3, thresholds).bitCount != 47)
             return false;
+        unpack_words(data, 1, words, 47);
         invert_bytes(data, 6);
-        byte calculated_crc = crc8(data + 1, 4, 0x31, 0);
+        byte calculated_crc = crc8_table<0x31>(data + 1, 4, 0);
 #ifdef PLUGIN_050_DEBUG
         const size_t buflen = sizeof(PLUGIN_050_ID ": packet = ") + 32;
         char printbuf[buflen];
@@ -69,12 +73,17 @@ boolean Plugin_050(byte function, const char *string)
             return false;
         }
         
-        uint16_t unitid = (data[1] << 4) | (data[2] >> 4);
-        uint16_t temperature = ((data[2] & 0xF) << 8) | data[3];
+        // unit id, temperature, humidity
+        typedef BitLayout<BitField<8, 12>, BitField<20, 12>, BitField<32, 8>> FineOffsetLayout;
+        uint32_t fields[FineOffsetLayout::count];
+        FineOffsetLayout::extract(data, fields);
+
+        uint16_t unitid = fields[0];
+        uint16_t temperature = fields[1];
         //MSB of 12-bit number actually indicates sign, this isn't standard two's complement
         if(temperature & 0x800)
             temperature = - (temperature & 0x7FF);
-        byte humidity = data[4];
+        byte humidity = fields[2];
         display_Header();
         display_Name(PLUGIN_050_ID);
         display_IDn(unitid, 4);  // unit id
@@ -94,6 +94,7 @@
 
 #define PLUGIN_051_ID "HyWS77TH"
 #define HYWS77TH_PULSECOUNT 74
+#define PLUGIN_PULSES_051 {HYWS77TH_PULSECOUNT, HYWS77TH_PULSECOUNT}
 
 //#define PLUGIN_051_DEBUG
 
@@ -221,9 +222,7 @@ boolean Plugin_051(byte function, const char *string)
   // Prevent repeating signals from showing up
   //==================================================================================
   bitstream = (hdr << 20) | (tmpu << 8) | hum;  // reconstruct bitsteam-like word
-  if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 600 < millis()) || (SignalCRC != bitstream))
-    SignalCRC = bitstream; // not seen the RF packet recently
-  else {
+  if (RepeatCache::isRepeat(0, bitstream, 600)) {
     #ifdef PLUGIN_051_DEBUG
       Serial.println(PLUGIN_051_ID ": Duplicated packet detected");
     #endif
@@ -243,8 +242,6 @@ boolean Plugin_051(byte function, const char *string)
   display_BAT(batlow == 0);
   display_Footer();
 
-  RawSignal.Repeats = true; // suppress repeats of the same RF packet
-  RawSignal.Number = 0;
   return true;
 }
 
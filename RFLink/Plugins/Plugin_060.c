@@ -30,6 +30,7 @@
 #define PLUGIN_DESC_060 "X10"
 
 #define ALARMPIRV0_PULSECOUNT 26
+#define PLUGIN_PULSES_060 {ALARMPIRV0_PULSECOUNT, ALARMPIRV0_PULSECOUNT}
 
 #define ALARMPIRV0_PULSEMID_D 700
 #define ALARMPIRV0_PULSEMAX_D 1000
@@ -80,17 +81,10 @@ boolean Plugin_060(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 2000 < millis()))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (RepeatCache::isRepeat(0, bitstream, 2000))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Output
    // ----------------------------------
@@ -101,8 +95,6 @@ boolean Plugin_060(byte function, const char *string)
    display_CMD(CMD_Single, CMD_On); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_060
@@ -40,6 +40,7 @@
 #define PLUGIN_DESC_061 "EV1527"
 
 #define ALARMPIRV1_PULSECOUNT 50
+#define PLUGIN_PULSES_061 {ALARMPIRV1_PULSECOUNT, ALARMPIRV1_PULSECOUNT}
 
 #define ALARMPIRV1_PULSEMID_D 600
 #define ALARMPIRV1_PULSEMAX_D 1300
@@ -52,7 +53,7 @@ boolean Plugin_061(byte function, const char *string)
 {
    if (RawSignal.Number != ALARMPIRV1_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[0] == 63)
+   if (DispatchResult.routeHint == 63)
       return false; // No need to test, packet for plugin 63
 
    const long ALARMPIRV1_PULSEMID = ALARMPIRV1_PULSEMID_D / RawSignal.Multiply;
@@ -87,19 +88,10 @@ boolean Plugin_061(byte function, const char *string)
    // Prevent repeating signals from showing up
    //==================================================================================
 
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 200) < millis()) || (SignalCRC != bitstream))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-
-      SignalCRC = bitstream;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (RepeatCache::isRepeat(0, bitstream, 200))
+      return true; // already seen the RF packet recently
    //==================================================================================
    bitstream2 = (bitstream) >> 16;
    if ((bitstream2) == 0xff)
@@ -117,8 +109,6 @@ boolean Plugin_061(byte function, const char *string)
    display_CMD(CMD_Single, CMD_On); // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // Plugin_061
@@ -27,6 +27,7 @@
 #define PLUGIN_DESC_062 "Chuango"
 
 #define ALARMPIRV2_PULSECOUNT 50
+#define PLUGIN_PULSES_062 {ALARMPIRV2_PULSECOUNT, ALARMPIRV2_PULSECOUNT}
 
 #define ALARMPIRV2_PULSEMID_D 700
 #define ALARMPIRV2_PULSEMAX_D 200
@@ -40,7 +41,7 @@ boolean Plugin_062(byte function, const char *string)
 {
    if (RawSignal.Number != ALARMPIRV2_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[0] == 63)
+   if (DispatchResult.routeHint == 63)
       return false; // No need to test, packet for plugin 63
 
    const long ALARMPIRV2_PULSEMID = ALARMPIRV2_PULSEMID_D / RawSignal.Multiply;
@@ -73,19 +74,10 @@ boolean Plugin_062(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 200) < millis()) || (SignalCRC != bitstream))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-
-      SignalCRC = bitstream;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (RepeatCache::isRepeat(0, bitstream, 200))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // Validity checks
    //==================================================================================
@@ -99,8 +91,6 @@ boolean Plugin_062(byte function, const char *string)
    display_Footer();
 
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // Plugin_062
@@ -23,6 +23,7 @@
 #define PLUGIN_DESC_063 "X10"
 
 #define OREGON_PLA_PULSECOUNT 52
+#define PLUGIN_PULSES_063 {OREGON_PLA_PULSECOUNT - 2, OREGON_PLA_PULSECOUNT}
 
 #ifdef PLUGIN_063
 #include "../4_Display.h"
@@ -32,9 +33,9 @@ boolean Plugin_063(byte function, const char *string)
    if ((RawSignal.Number < OREGON_PLA_PULSECOUNT - 2) || (RawSignal.Number > OREGON_PLA_PULSECOUNT))
       return false;
 
-   if (RawSignal.Pulses[0] != 63)
+   if (DispatchResult.routeHint != 63)
       return false; // Only accept RF packets converted by plugin 1
-   RawSignal.Pulses[0] = 0;
+   DispatchResult.routeHint = 0;
 
    unsigned long bitstream = 0L;
    //==================================================================================
@@ -74,17 +75,10 @@ boolean Plugin_063(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || (RepeatingTimer + 2000 < millis()))
-   {
-      // not seen the RF packet recently
-      if (bitstream == 0)
-         return false;
-   }
-   else
-   {
-      // already seen the RF packet recently
-      return true;
-   }
+   if (bitstream == 0)
+      return false;
+   if (RepeatCache::isRepeat(0, bitstream, 2000))
+      return true; // already seen the RF packet recently
    //==================================================================================
    // calculate sensor and channel
    bitstream = (bitstream) >> 4;
@@ -100,8 +94,6 @@ boolean Plugin_063(byte function, const char *string)
    display_CMD(CMD_Single, CMD_On);        // #ALL #ON
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // Plugin_063
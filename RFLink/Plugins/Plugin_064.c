@@ -24,6 +24,7 @@
 #define PLUGIN_DESC_064 "Atlantic"
 #define ATLANTIC_PULSECOUNT 74
 #define ATLANTIC_PULSECOUNT_TOO_SHORT_BREAK 223
+#define PLUGIN_PULSES_064 {ATLANTIC_PULSECOUNT, ATLANTIC_PULSECOUNT}, {ATLANTIC_PULSECOUNT_TOO_SHORT_BREAK, ATLANTIC_PULSECOUNT_TOO_SHORT_BREAK}
 
 #define ATLANTIC_PULSE_MID_D 600
 #define ATLANTIC_PULSE_MIN_D 300
@@ -77,9 +78,7 @@ boolean Plugin_064(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer) + 700 < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream;
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 700))
       return true; // packet already seen
    //==================================================================================
    // Extract data
@@ -96,8 +95,6 @@ boolean Plugin_064(byte function, const char *string)
    display_CMD(CMD_Single, alarm ? CMD_On : CMD_Off);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // Plugin_064
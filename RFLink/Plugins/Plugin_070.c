@@ -45,6 +45,7 @@
 #define SELECTPLUS_PLUGIN_ID 070
 #define PLUGIN_DESC_070 "SelectPlus"
 #define SELECTPLUS_PULSECOUNT 36
+#define PLUGIN_PULSES_070 {SELECTPLUS_PULSECOUNT, SELECTPLUS_PULSECOUNT}
 
 #define SELECTPLUS_PULSEMID_D 650
 #define SELECTPLUS_PULSEMAX_D 2125
@@ -91,9 +92,7 @@ boolean Plugin_070(byte function, const char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (RepeatCache::isRepeat(0, bitstream, 1000))
         return true; // already seen the RF packet recently
     //==================================================================================
     // all bytes received, make sure checksum is okay
@@ -112,8 +111,6 @@ boolean Plugin_070(byte function, const char *string)
     display_CHIME(1);
     display_Footer();
     //==================================================================================
-    RawSignal.Repeats = true; // suppress repeats of the same RF packet
-    RawSignal.Number = 0;     // do not process the packet any further
     return true;
 }
 #endif // PLUGIN_070
@@ -39,6 +39,7 @@
 #define PLUGIN_DESC_071 "Plieger"
 
 #define PLIEGER_PULSECOUNT 66
+#define PLUGIN_PULSES_071 {PLIEGER_PULSECOUNT, PLIEGER_PULSECOUNT}
 
 #define PLIEGER_PULSEMID_D 700
 #define PLIEGER_PULSEMAX_D 1900
@@ -88,9 +89,7 @@ boolean Plugin_071(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    id = ((bitstream >> 16) & 0xFFFF); // get 16 bits unique address
@@ -120,8 +119,6 @@ boolean Plugin_071(byte function, const char *string)
    display_CHIME(chime);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;     // do not process the packet any further
    return true;
 }
 #endif // PLUGIN_071
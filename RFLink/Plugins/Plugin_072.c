@@ -33,6 +33,7 @@
 #define PLUGIN_DESC_072 "Byron SX"
 
 #define BYRON_PULSECOUNT 26
+#define PLUGIN_PULSES_072 {BYRON_PULSECOUNT, BYRON_PULSECOUNT}
 
 #define BYRONSTART 3000
 #define BYRONSPACE 250
@@ -46,7 +47,7 @@ boolean Plugin_072(byte function, const char *string)
 {
    if (RawSignal.Number != BYRON_PULSECOUNT)
       return false;
-   if (RawSignal.Pulses[0] != BYRON_PLUGIN_ID)
+   if (DispatchResult.routeHint != BYRON_PLUGIN_ID)
       return false; // only accept plugin1 translated packets
    if (RawSignal.Pulses[1] * RawSignal.Multiply > 425)
       return false; // first pulse is start bit and must be short
@@ -85,9 +86,7 @@ boolean Plugin_072(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -100,8 +99,6 @@ boolean Plugin_072(byte function, const char *string)
    display_CHIME((bitstream & 0xF));
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_072
@@ -35,6 +35,7 @@
 #define PLUGIN_DESC_073 "Deltronic"
 
 #define DELTRONIC_PULSECOUNT 26
+#define PLUGIN_PULSES_073 {DELTRONIC_PULSECOUNT, DELTRONIC_PULSECOUNT}
 
 #define LENGTH_DEVIATION 300
 
@@ -87,9 +88,7 @@ boolean Plugin_073(byte function, const char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (RepeatCache::isRepeat(0, bitstream, 1000))
         return true; // already seen the RF packet recently
     //==================================================================================
     // Output
@@ -102,8 +101,6 @@ boolean Plugin_073(byte function, const char *string)
     display_CHIME(1);
     display_Footer();
     //==================================================================================
-    RawSignal.Repeats = true; // suppress repeats of the same RF packet
-    RawSignal.Number = 0;     // do not process the packet any further
     return true;
 }
 #endif // PLUGIN_073
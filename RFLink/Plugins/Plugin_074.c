@@ -37,6 +37,7 @@
 #define PLUGIN_DESC_074 "Byron MP"
 
 #define RL02_CodeLength 12
+#define PLUGIN_PULSES_074 {(RL02_CodeLength * 4) + 2, (RL02_CodeLength * 4) + 2}
 
 #define RL02_T 125 // 175 uS
 
@@ -97,9 +98,7 @@ boolean Plugin_074(byte function, const char *string)
     //==================================================================================
     // Prevent repeating signals from showing up
     //==================================================================================
-    if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-        SignalCRC = bitstream; // not seen the RF packet recently
-    else
+    if (RepeatCache::isRepeat(0, bitstream, 1000))
         return true; // already seen the RF packet recently
     //==================================================================================
     // Output
@@ -112,8 +111,6 @@ boolean Plugin_074(byte function, const char *string)
     display_CHIME(1);
     display_Footer();
     // ----------------------------------
-    RawSignal.Repeats = true;
-    RawSignal.Number = 0;
     return true;
 }
 #endif //PLUGIN_074
@@ -41,6 +41,7 @@
 
 #define LIDL_PULSECOUNT 90   // type 0
 #define LIDL_PULSECOUNT2 114 // type 1
+#define PLUGIN_PULSES_075 {LIDL_PULSECOUNT, LIDL_PULSECOUNT}, {LIDL_PULSECOUNT2, LIDL_PULSECOUNT2}
 
 #ifdef PLUGIN_075
 #include "../4_Display.h"
@@ -101,7 +102,7 @@ boolean Plugin_075(byte function, const char *string)
    }
    else
    {
-      if (RawSignal.Pulses[0] != LIDL_PLUGIN_ID)
+      if (DispatchResult.routeHint != LIDL_PLUGIN_ID)
          return false; // only accept plugin1 translated packets
       type = 1;
       for (byte x = 1; x < LIDL_PULSECOUNT2 - 1; x += 2)
@@ -154,9 +155,7 @@ boolean Plugin_075(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 1000) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 1000))
       return true; // already seen the RF packet recently
    //==================================================================================
    // Output
@@ -172,8 +171,6 @@ boolean Plugin_075(byte function, const char *string)
    display_CHIME(1);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;     // do not process the packet any further
    return true;
 }
 #endif // PLUGIN_075_CORE
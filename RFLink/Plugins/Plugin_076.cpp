@@ -41,6 +41,7 @@ using namespace RFLink::Radio;
 #define PLUGIN_DESC_076 "CAME-TOP432"
 
 #define PLUGIN_076_PULSE_COUNT 26
+#define PLUGIN_PULSES_076 {PLUGIN_076_PULSE_COUNT, PLUGIN_076_PULSE_COUNT}
 
 #define PLUGIN_076_PREAMBLE 290
 // #define PLUGIN_076_PREAMBLE_MIN 368 <--- RXB6 sees fat pulses
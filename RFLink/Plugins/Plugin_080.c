@@ -38,6 +38,7 @@
 #define PLUGIN_DESC_080 "FA20RF"
 
 #define FA20_PULSECOUNT 50
+#define PLUGIN_PULSES_080 {FA20_PULSECOUNT, FA20_PULSECOUNT}
 
 #define FA20_MIDHI_D 1000
 #define FA20_PULSEMIN_D 1000
@@ -103,8 +104,6 @@ boolean Plugin_080(byte function, const char *string)
    display_SMOKEALERT(SMOKE_On);
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;     // do not process the packet any further
    return true;
 }
 #endif // PLUGIN_080
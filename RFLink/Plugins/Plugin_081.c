@@ -44,6 +44,7 @@
 #define PLUGIN_DESC_081 "Mertik"
 
 #define MAXITROL1_PULSECOUNT 46
+#define PLUGIN_PULSES_081 {MAXITROL1_PULSECOUNT, MAXITROL1_PULSECOUNT}
 
 #define MAXITROL1_MID 550
 #define MAXITROL1_PULSEMINMAX_D 550
@@ -101,9 +102,7 @@ boolean Plugin_081(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    command = (bitstream & 0x0F); // get address from pulses
@@ -169,8 +168,6 @@ boolean Plugin_081(byte function, const char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_081
@@ -44,6 +44,7 @@
 #define PLUGIN_DESC_082 "Mertik v2"
 
 #define MAXITROL2_PULSECOUNT 26
+#define PLUGIN_PULSES_082 {MAXITROL2_PULSECOUNT, MAXITROL2_PULSECOUNT}
 
 #define MAXITROL2_MID_D 550
 #define MAXITROL2_PULSEMINMAX_D 550
@@ -102,9 +103,7 @@ boolean Plugin_082(byte function, const char *string)
    //==================================================================================
    // Prevent repeating signals from showing up
    //==================================================================================
-   if ((SignalHash != SignalHashPrevious) || ((RepeatingTimer + 500) < millis()) || (SignalCRC != bitstream))
-      SignalCRC = bitstream; // not seen the RF packet recently
-   else
+   if (RepeatCache::isRepeat(0, bitstream, 500))
       return true; // already seen the RF packet recently
    //==================================================================================
    command = (bitstream & 0x0F); // get address from pulses
@@ -170,8 +169,6 @@ boolean Plugin_082(byte function, const char *string)
    }
    display_Footer();
    //==================================================================================
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_082
@@ -30,6 +30,7 @@
 #define DOOYA_PLUGIN_ID 083
 #define PLUGIN_DESC_083 PSTR("BRELMOTOR")
 #define DOOYA_PULSECOUNT_1 82
+#define PLUGIN_PULSES_083 {DOOYA_PULSECOUNT_1, DOOYA_PULSECOUNT_1}
 
 #define DOOYA_MIDVALUE_D 384
 
@@ -144,8 +145,6 @@ boolean Plugin_083(byte function, const char *string)
          return false;
       }  
 
-   RawSignal.Repeats = true; // suppress repeats of the same RF packet
-   RawSignal.Number = 0;
    return true;
 }
 #endif // PLUGIN_0083
@@ -32,6 +32,7 @@
 #define NOX_PULSE_LONG_LEN_MAX 1050
 
 #define NOX_CONTROL_PULSECOUNT 66
+#define PLUGIN_PULSES_087 {NOX_CONTROL_PULSECOUNT, NOX_CONTROL_PULSECOUNT}
 
 
 #ifdef PLUGIN_087
@@ -0,0 +1,27 @@
+//#######################################################################################################
+//##                    This Plugin is only for use with the RFLink software package                   ##
+//##                                  Plugin-100: Flex decoder                                         ##
+//#######################################################################################################
+/*********************************************************************************************\
+ * This plugin decodes the signals described by the rules of the 'flex' config section.
+ * It makes it possible to receive simple OOK remotes and sensors (PWM, PPM or Manchester coded)
+ * without writing a plugin and reflashing, see 14_Flex.h and the CLI Reference Guide.
+ *
+ * License            : This code is free for use in any open source project when this header is included.
+ *                      Usage of any parts of this code in a commercial application is prohibited!
+ ***********************************************************************************************
+ * Technical description:
+ * Rules are compiled into matcher tables when the configuration is loaded or changed, this plugin
+ * only runs them against RawSignal. Output is:
+ * 20;XX;<rule name>;ID=<id field>;<field name>=<hex value>;...;
+ \*********************************************************************************************/
+#define PLUGIN_DESC_100 "Flex"
+
+#ifdef PLUGIN_100
+#include "../14_Flex.h"
+
+boolean Plugin_100(byte function, const char *string)
+{
+   return RFLink::Flex::decode();
+}
+#endif // PLUGIN_100
@@ -64,7 +64,6 @@ boolean Plugin_254(byte function, const char *string)
    }
    RFLink::sendRawPrint(F(";\r\n"));
    // ----------------------------------
-   RawSignal.Number = 0; // Last plugin, kill packet
    return true;          // stop processing
 }
 #endif // PLUGIN_254
@@ -99,6 +99,10 @@
 // 868 MHZ
 // -------------------
 // -------------------
+// Rules from config
+// -------------------
+#define PLUGIN_100 // Flex decoder
+// -------------------
 // Housekeeping
 // -------------------
 #define PLUGIN_254 // Debug to show unsupported packets
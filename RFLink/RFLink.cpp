@@ -31,6 +31,8 @@
 #include "11_Config.h"
 #include "12_Portal.h"
 #include "13_OTA.h"
+#include "14_Flex.h"
+#include "15_Capture.h"
 
 #if (defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__))
 #include <avr/power.h>
@@ -93,9 +95,13 @@ namespace RFLink {
       display_Splash();
       display_Footer();
 
+      // other sinks are not set up yet, the splash only goes to Serial
 #ifdef SERIAL_ENABLED
+      pbuffer[0] = 0;
+      formatEventText(*outputQueue.peek(), pbufferBuilder);
       Serial.print(pbuffer);
 #endif
+      outputQueue.pop();
 #ifdef OLED_ENABLED
       splash_OLED();
 #endif
@@ -105,6 +111,7 @@ namespace RFLink {
 #endif
       RFLink::Radio::setup();
       RFLink::Signal::setup();
+      RFLink::Flex::setup();
 
 #if defined(RFLINK_WIFI_ENABLED)
       RFLink::Wifi::setup();
@@ -139,6 +146,10 @@ namespace RFLink {
       pbuffer[0] = 0;
       Radio::set_Radio_mode(Radio::Radio_RX);
 
+#ifdef RFLINK_SIGNAL_TASK_ENABLED
+      RFLink::Signal::ScanTask::start();
+#endif
+
 
 #ifdef RFLINK_WIFI_ENABLED
   #ifndef RFLINK_PORTAL_DISABLED
@@ -168,9 +179,12 @@ namespace RFLink {
       readSerialAndExecute();
 #endif
 
+#ifndef RFLINK_SIGNAL_TASK_ENABLED
       if (RFLink::Signal::ScanEvent()) {
         RFLink::sendMsgFromBuffer();
       }
+#endif
+      RFLink::Capture::mainLoop();
 
       struct timeval now;
       gettimeofday(&now, nullptr);
@@ -183,33 +197,142 @@ namespace RFLink {
       OTA::mainLoop();
     }
 
+    // Sinks an event was handed to, in MessageQueue::deliveredTo()
+    enum OutputSinks {
+      Sink_Serial = 0x01,
+      Sink_Mqtt = 0x02,
+      Sink_Serial2Net = 0x04,
+      Sink_OLED = 0x08,
+      Event_Counted = 0x80, // truncation already counted
+    };
+
+    static const byte enabledSinks = 0
+#ifdef SERIAL_ENABLED
+                                     | Sink_Serial
+#endif
+#ifndef RFLINK_MQTT_DISABLED
+                                     | Sink_Mqtt
+#endif
+#ifndef RFLINK_SERIAL2NET_DISABLED
+                                     | Sink_Serial2Net
+#endif
+#ifdef OLED_ENABLED
+                                     | Sink_OLED
+#endif
+        ;
+
+    // text printed by the Signal task, the main loop writes it out before the events
+    static void sendScanTaskPrints() {
+      char chunk[64];
+      size_t length;
+      while ((length = Signal::ScanTask::takePrinted(chunk, sizeof(chunk) - 1)) > 0) {
+        chunk[length] = 0;
+#ifdef SERIAL_ENABLED
+        Serial.print(chunk);
+#endif
+#ifndef RFLINK_SERIAL2NET_DISABLED
+        RFLink::Serial2Net::broadcastMessage(chunk);
+#endif // !RFLINK_SERIAL2NET_DISABLED
+      }
+    }
+
+    static int pbufferSequence = -1; // event whose text is in pbuffer, a busy UART does not get it formatted again
+
+    static void popEvent() {
+      if (outputQueue.peek()->sequence == pbufferSequence)
+        pbufferSequence = -1;
+      outputQueue.pop();
+    }
+
     void sendMsgFromBuffer() {
-      if (pbuffer[0] != 0) {
+      // main loop is the only consumer of outputQueue and the only writer to the sinks,
+      // the Signal task queues what it prints with sendRawPrint(), so nothing here needs the Signal lock.
+      // Every sink takes the events as soon as it can, a busy UART only holds Serial back.
+      // Text is only formatted for the sinks which are about to write it, once per event.
+      sendScanTaskPrints();
+
+      bool serialReady = true; // Serial keeps the order, it stops at the first event it cannot take
+      const EventRecord *event;
+      for (byte position = 0; (event = outputQueue.peek(position)) != nullptr; position++) {
+        byte &delivered = outputQueue.deliveredTo(position);
+        byte pending = enabledSinks & ~delivered;
+        if (!serialReady)
+          pending &= ~Sink_Serial;
+        if (pending == 0)
+          continue;
+
+        bool needsText = (pending & (Sink_Serial | Sink_OLED)) != 0;
+#ifndef RFLINK_MQTT_DISABLED
+        if ((pending & Sink_Mqtt) && RFLink::Mqtt::needsEventText())
+          needsText = true;
+#endif
+#ifndef RFLINK_SERIAL2NET_DISABLED
+        if ((pending & Sink_Serial2Net) && RFLink::Serial2Net::hasClients())
+          needsText = true;
+#endif
+        if (needsText && pbufferSequence != event->sequence) {
+          // truncation is only counted once, even if the text has to be formatted again
+          pbuffer[0] = 0;
+          formatEventText(*event, pbufferBuilder, (delivered & Event_Counted) == 0);
+          pbufferSequence = event->sequence;
+        }
+        else if (!needsText && event->truncated && (delivered & Event_Counted) == 0)
+          display_TruncatedMessagesCount++;
+        delivered |= Event_Counted;
 
 #ifdef SERIAL_ENABLED
-        Serial.print(pbuffer);
+        if (pending & Sink_Serial) {
+          if (Serial.availableForWrite() < (int)strlen(pbuffer))
+            serialReady = false; // UART is still busy with previous output, let's come back on next loop rather than wait for it
+          else {
+            Serial.print(pbuffer);
+            delivered |= Sink_Serial;
+          }
+        }
 #endif
 
 #ifndef RFLINK_MQTT_DISABLED
-        RFLink::Mqtt::publishMsg();
+        if (pending & Sink_Mqtt) {
+          RFLink::Mqtt::publishEvent(*event, pbuffer);
+          delivered |= Sink_Mqtt;
+        }
 #endif // !RFLINK_MQTT_DISABLED
 
 
 #ifndef RFLINK_SERIAL2NET_DISABLED
-        RFLink::Serial2Net::broadcastMessage(pbuffer);
+        if (pending & Sink_Serial2Net) {
+          RFLink::Serial2Net::broadcastMessage(pbuffer);
+          delivered |= Sink_Serial2Net;
+        }
 #endif // !RFLINK_SERIAL2NET_DISABLED
 
 #ifdef OLED_ENABLED
-        print_OLED();
+        if (pending & Sink_OLED) {
+          print_OLED(pbuffer);
+          delivered |= Sink_OLED;
+        }
 #endif
+      }
 
-        pbuffer[0] = 0;
+      while (!outputQueue.isEmpty() && (outputQueue.deliveredTo() & enabledSinks) == enabledSinks)
+        popEvent();
+
+      if (outputQueue.isFull()) {
+        // only Serial can be late, rather than every sink losing the next events it gives up the oldest one
+        outputQueue.skippedCount++;
+        popEvent();
       }
     }
 
     void sendRawPrint(const char *buf, bool end_of_line) {
       if (buf[0] != 0) {
 
+        if (Signal::ScanTask::print(buf)) { // Signal task, the main loop will write it
+          if (end_of_line)
+            Signal::ScanTask::print("\r\n");
+          return;
+        }
+
 #ifdef SERIAL_ENABLED
         Serial.print(buf);
         if(end_of_line)
@@ -226,65 +349,45 @@ namespace RFLink {
 
     void sendRawPrint(long n)
     {
-#ifdef SERIAL_ENABLED
-      Serial.print(n);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(String(n).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      char text[12];
+      snprintf(text, sizeof(text), "%ld", n);
+      sendRawPrint(text);
     }
 
     void sendRawPrint(unsigned long n)
     {
-#ifdef SERIAL_ENABLED
-      Serial.print(n);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(String(n).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      char text[12];
+      snprintf(text, sizeof(text), "%lu", n);
+      sendRawPrint(text);
     }
 
     void sendRawPrint(int n)
     {
-#ifdef SERIAL_ENABLED
-      Serial.print(n);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(String(n).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      sendRawPrint((long)n);
     }
 
     void sendRawPrint(unsigned int n)
     {
-#ifdef SERIAL_ENABLED
-      Serial.print(n);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(String(n).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      sendRawPrint((unsigned long)n);
     }
 
   void sendRawPrint(float f)
   {
-#ifdef SERIAL_ENABLED
-    Serial.print(f);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-    RFLink::Serial2Net::broadcastMessage(String(f).c_str());
-#endif // !RFLINK_SERIAL2NET_DISABLED
+    sendRawPrint(String(f).c_str());
   }
 
     void sendRawPrint(char c)
     {
-#ifdef SERIAL_ENABLED
-      Serial.write(c);
-#endif
-#ifndef RFLINK_SERIAL2NET_DISABLED
-      RFLink::Serial2Net::broadcastMessage(c);
-#endif // !RFLINK_SERIAL2NET_DISABLED
+      char text[2] = {c, 0};
+      sendRawPrint(text);
     }
 
     void sendRawPrint(const __FlashStringHelper *buf, bool end_of_line){
+      if (Signal::ScanTask::isTask()) {
+        sendRawPrint(String(buf).c_str(), end_of_line);
+        return;
+      }
+
       #ifdef SERIAL_ENABLED
       Serial.print(buf);
       if(end_of_line)
@@ -302,6 +405,8 @@ namespace RFLink {
     bool executeCliCommand(char *cmd) {
       static byte ValidCommand = 0;
 
+      Signal::ScanTask::suspend(); // plugins and responses share RawSignal, the radio and the event being recorded with the Signal task
+
       // Copy input command to InputBuffer_Serial, because many plugins are based on it !
       if(cmd != InputBuffer_Serial) { // sometimes we already have the command in the right buffer
         memcpy(InputBuffer_Serial, cmd, INPUT_COMMAND_SIZE);;
@@ -390,6 +495,12 @@ namespace RFLink {
             Signal::executeCliCommand(cmd + 3 + 6 + 1);
           } else if (strncasecmp(cmd + 3, "config", 6) == 0) {
             Config::executeCliCommand(cmd + 3 + 6 + 1);
+          } else if (strncasecmp(cmd + 3, "plugins", 7) == 0) {
+            Plugin::executeCliCommand(cmd + 3 + 7 + 1);
+          } else if (strncasecmp(cmd + 3, "flex", 4) == 0) {
+            Flex::executeCliCommand(cmd + 3 + 4 + 1);
+          } else if (strncasecmp(cmd + 3, "capture", 7) == 0) {
+            Capture::executeCliCommand(cmd + 3 + 7 + 1);
           } else {
             // -------------------------------------------------------
             // Handle Generic Commands / Translate protocol data into Nodo text commands
@@ -422,6 +533,7 @@ namespace RFLink {
       ValidCommand = 0;
       sendMsgFromBuffer(); // in case there is a response waiting to be sent
       resetSerialBuffer();
+      Signal::ScanTask::resume();
       return true;
     }
 
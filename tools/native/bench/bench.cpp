@@ -0,0 +1,258 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Decode throughput benchmark: replays pulse corpora through the plugins and reports, as JSON,
+// the cost of a whole PluginRXCall() and, for every plugin, the cost of the frames it decodes and
+// of the ones it rejects.
+//
+//   .pio/build/native_bench/program [-t ms] [-o results.json] corpus ...
+//
+// Corpora are read like tools/native/src/main.cpp does, so plugin sources themselves can be
+// given: their "20;XX;DEBUG;Pulses=" lines and "temp[]={...}" arrays are used.
+// -t is the minimum measuring time of every figure, 100 ms by default.
+//
+// Plugins are called directly on whole frames, the way PluginRXCall() calls them on the first
+// pass. A frame is only given to the plugins whose PLUGIN_PULSES_xxx ranges accept its pulse
+// count, as the dispatch index does. Restoring the frame and computing its features before every
+// call is measured on its own and subtracted.
+
+#include <chrono>
+#include <vector>
+#include <Arduino.h> // after the standard headers, its min() and max() macros break them
+#include "2_Signal.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+#include "RFLinkNative.h"
+
+using namespace RFLink;
+
+namespace
+{
+  struct Frame
+  {
+    std::vector<uint16_t> pulses; // same layout as RawSignal.Pulses, element 0 unused
+  };
+
+  struct Timing
+  {
+    unsigned long frames = 0;
+    double ns_per_frame = 0;
+  };
+
+  std::vector<Frame> corpus;
+  double budget_ns = 100e6;
+
+  void discardMessage(const char *) {}
+
+  void loadCorpus(const char *path)
+  {
+    FILE *input = fopen(path, "r");
+    if (!input)
+    {
+      perror(path);
+      exit(2);
+    }
+
+    static char line[16384];
+    while (fgets(line, sizeof(line), input))
+    {
+      if (!Native::loadPulses(line, Signal::RawSignal))
+        continue;
+
+      Frame frame;
+      frame.pulses.assign(Signal::RawSignal.Pulses, Signal::RawSignal.Pulses + Signal::RawSignal.Number + 1);
+      corpus.push_back(frame);
+    }
+    fclose(input);
+  }
+
+  // Puts the frame back in RawSignal as the slicers leave it, plugins may have reworked it
+  inline void restoreFrame(const Frame &frame)
+  {
+    Signal::RawSignal.Number = frame.pulses.size() - 1;
+    memcpy(Signal::RawSignal.Pulses, frame.pulses.data(), frame.pulses.size() * sizeof(uint16_t));
+    Signal::RawSignal.Multiply = Signal::params::sample_rate;
+    Signal::RawSignal.Repeats = 0;
+    Signal::RawSignal.Delay = 0;
+    // some plugins suppress repeats on their own: every frame is a new transmission
+    Native::advanceMicros(1000000UL);
+    Signal::RawSignal.Time = millis();
+  }
+
+  inline void prepareFrame(const Frame &frame)
+  {
+    restoreFrame(frame);
+    Signal::computeFrameFeatures(Signal::RawSignal, Signal::FrameFeatures);
+  }
+
+  double nowNs()
+  {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /**
+   * Runs call(frame) over frames until budget_ns has elapsed, minus the time spent in prepare(frame)
+   * @return nanoseconds per call
+   * */
+  template <typename Prepare, typename Call>
+  double measure(const std::vector<const Frame *> &frames, Prepare prepare, Call call)
+  {
+    if (frames.empty())
+      return 0;
+
+    unsigned long rounds = 0;
+    double start = nowNs();
+    double elapsed;
+    do
+    {
+      for (const Frame *frame : frames)
+      {
+        prepare(*frame);
+        call();
+        outputQueue.clear();
+      }
+      rounds++;
+    } while ((elapsed = nowNs() - start) < budget_ns);
+
+    start = nowNs();
+    for (unsigned long r = 0; r < rounds; r++)
+    {
+      for (const Frame *frame : frames)
+      {
+        prepare(*frame);
+        outputQueue.clear();
+      }
+    }
+    double overhead = nowNs() - start;
+
+    double ns = (elapsed - overhead) / (rounds * frames.size());
+    return ns > 0 ? ns : 0;
+  }
+
+  void printJsonString(FILE *output, const char *text)
+  {
+    fputc('"', output);
+    for (; *text; text++)
+    {
+      if (*text == '"' || *text == '\\')
+        fputc('\\', output);
+      if ((unsigned char)*text >= 0x20)
+        fputc(*text, output);
+    }
+    fputc('"', output);
+  }
+
+  void printTiming(FILE *output, const char *name, const Timing &timing)
+  {
+    fprintf(output, "\"%s\": {\"frames\": %lu, \"ns_per_frame\": %.1f, \"frames_per_s\": %.0f}",
+            name, timing.frames, timing.ns_per_frame, timing.ns_per_frame > 0 ? 1e9 / timing.ns_per_frame : 0);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const char *outputPath = nullptr;
+  int i = 1;
+  for (; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+      budget_ns = atof(argv[++i]) * 1e6;
+    else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+      outputPath = argv[++i];
+    else
+    {
+      fprintf(stderr, "usage: %s [-t ms] [-o results.json] corpus ...\n", argv[0]);
+      return 2;
+    }
+  }
+
+  Native::setSerialOutput(nullptr);
+  Native::setMessageSink(discardMessage);
+  Native::setup();
+  Native::setMicros(0);
+
+  for (; i < argc; i++)
+    loadCorpus(argv[i]);
+  if (corpus.empty())
+  {
+    fprintf(stderr, "no frame found in corpus\n");
+    return 2;
+  }
+
+  std::vector<const Frame *> allFrames;
+  for (const Frame &frame : corpus)
+    allFrames.push_back(&frame);
+
+  // Whole dispatch, as Signal::ScanEvent() runs it
+  Timing dispatch;
+  unsigned long decoded = 0;
+  for (const Frame *frame : allFrames)
+  {
+    restoreFrame(*frame);
+    if (PluginRXCall(0, 0))
+      decoded++;
+    outputQueue.clear();
+  }
+  dispatch.frames = allFrames.size();
+  dispatch.ns_per_frame = measure(allFrames, restoreFrame, []() { PluginRXCall(0, 0); });
+
+  FILE *output = outputPath ? fopen(outputPath, "w") : stdout;
+  if (!output)
+  {
+    perror(outputPath);
+    return 2;
+  }
+
+  fprintf(output, "{\n  \"corpus\": {\"frames\": %u, \"decoded\": %lu},\n  ", (unsigned)corpus.size(), decoded);
+  printTiming(output, "dispatch", dispatch);
+  fprintf(output, ",\n  \"plugins\": [");
+
+  fprintf(stderr, "%u frames, %lu decoded, %.0f ns per PluginRXCall\n", (unsigned)corpus.size(), decoded, dispatch.ns_per_frame);
+  fprintf(stderr, "plugin  decoded  ns/frame  rejected  ns/frame  ns/corpus\n");
+
+  bool first = true;
+  for (byte x = 0; x < PLUGIN_MAX; x++)
+  {
+    if (Plugin_id[x] == 0 || Plugin_State[x] < P_Enabled)
+      continue;
+
+    std::vector<const Frame *> accepted, rejected;
+    for (const Frame *frame : allFrames)
+    {
+      if (!PluginAcceptsPulseCount(x, frame->pulses.size() - 1))
+        continue;
+      prepareFrame(*frame);
+      (Plugin_ptr[x](0, 0) ? accepted : rejected).push_back(frame);
+      outputQueue.clear();
+    }
+
+    auto call = [x]() { Plugin_ptr[x](0, 0); };
+    Timing decodedTiming, rejectedTiming;
+    decodedTiming.frames = accepted.size();
+    decodedTiming.ns_per_frame = measure(accepted, prepareFrame, call);
+    rejectedTiming.frames = rejected.size();
+    rejectedTiming.ns_per_frame = measure(rejected, prepareFrame, call);
+    // what this plugin costs the frames it cannot decode, per pass over the corpus
+    double rejectedTotal = rejectedTiming.ns_per_frame * rejectedTiming.frames;
+
+    fprintf(output, "%s\n    {\"id\": %u, \"name\": ", first ? "" : ",", Plugin_id[x]);
+    printJsonString(output, Plugin_Description[x]);
+    fprintf(output, ", ");
+    printTiming(output, "decoded", decodedTiming);
+    fprintf(output, ", ");
+    printTiming(output, "rejected", rejectedTiming);
+    fprintf(output, ", \"rejected_ns_per_corpus\": %.0f}", rejectedTotal);
+    first = false;
+
+    fprintf(stderr, "  %03u  %7lu  %8.0f  %8lu  %8.0f  %9.0f\n", Plugin_id[x],
+            decodedTiming.frames, decodedTiming.ns_per_frame, rejectedTiming.frames, rejectedTiming.ns_per_frame, rejectedTotal);
+  }
+
+  fprintf(output, "\n  ]\n}\n");
+  if (outputPath)
+    fclose(output);
+  return 0;
+}
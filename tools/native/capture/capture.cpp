@@ -0,0 +1,278 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Reads the captures recorded by the 10;capture; commands (see RFLink/15_Capture.h), either the binary file
+// or a log of the 20;XX;CAPTURE; lines streamed by the device.
+//
+//   .pio/build/native_capture/program info capture.rfc
+//   .pio/build/native_capture/program vcd capture.rfc > capture.vcd
+//   .pio/build/native_capture/program replay capture.rfc
+//   .pio/build/native_capture/program convert log.txt capture.rfc
+//
+// info lists the frames. vcd writes the receiver output as a Value Change Dump with a 1 us timescale, for
+// PulseView or sigrok-cli (-I vcd), every frame placed at the time it was received. replay decodes every
+// frame with the plugins. convert turns a log of streamed lines, or of 20;XX;DEBUG;Pulses= lines, into
+// a binary file.
+
+#include <string>
+#include <vector>
+#include <Arduino.h> // after the standard headers, its min() and max() macros break them
+#include "2_Signal.h"
+#include "15_Capture.h"
+#include "RFLinkNative.h"
+
+using namespace RFLink;
+
+namespace
+{
+  struct Recording
+  {
+    std::vector<uint8_t> bytes;
+    size_t headerSize;
+    unsigned long unixTime_s;
+    unsigned long start_ms;
+  };
+
+  void printMessage(const char *message)
+  {
+    fputs(message, stdout);
+  }
+
+  const char *slicerName(byte slicer)
+  {
+    static const char *names[] = {"Legacy", "RSSI_Advanced", "Legacy_Resumable"};
+    if (slicer < sizeof(names) / sizeof(names[0]))
+      return names[slicer];
+    if (slicer == CAPTURE_SLICER_ASYNC)
+      return "Async";
+    return "unknown";
+  }
+
+  void appendHex(std::vector<uint8_t> &bytes, const char *hex)
+  {
+    while (isxdigit(hex[0]) && isxdigit(hex[1]))
+    {
+      char digits[3] = {hex[0], hex[1], 0};
+      bytes.push_back(strtoul(digits, nullptr, 16));
+      hex += 2;
+    }
+  }
+
+  /**
+   * Loads a binary capture, or the hex lines of a streamed one from a log (the last recording of the log)
+   * */
+  bool load(const char *path, Recording &capture)
+  {
+    FILE *input = fopen(path, "rb");
+    if (!input)
+    {
+      perror(path);
+      return false;
+    }
+
+    std::vector<uint8_t> content;
+    uint8_t chunk[4096];
+    size_t size;
+    while ((size = fread(chunk, 1, sizeof(chunk), input)) > 0)
+      content.insert(content.end(), chunk, chunk + size);
+    fclose(input);
+
+    if (content.size() >= 4 && memcmp(content.data(), "RFLC", 4) == 0)
+      capture.bytes.swap(content);
+    else
+    {
+      content.push_back(0);
+      const char *text = (const char *)content.data();
+      const char *header = nullptr;
+      for (const char *found = strstr(text, "CAPTURE;Header="); found; found = strstr(found + 1, "CAPTURE;Header="))
+        header = found;
+      if (!header)
+      {
+        fprintf(stderr, "%s: not a capture file, nor a log holding a streamed capture\n", path);
+        return false;
+      }
+
+      appendHex(capture.bytes, header + strlen("CAPTURE;Header="));
+      for (const char *frame = strstr(header, "CAPTURE;Frame="); frame; frame = strstr(frame + 1, "CAPTURE;Frame="))
+        appendHex(capture.bytes, frame + strlen("CAPTURE;Frame="));
+    }
+
+    capture.headerSize = Capture::decodeHeader(capture.bytes.data(), capture.bytes.size(), capture.unixTime_s, capture.start_ms);
+    if (capture.headerSize == 0)
+    {
+      fprintf(stderr, "%s: unsupported capture header\n", path);
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Calls handle(info) for every frame, with the frame in RawSignal
+   * @return false if the capture ends with a truncated frame
+   * */
+  template <typename Handler>
+  bool forEachFrame(const Recording &capture, Handler handle)
+  {
+    size_t position = capture.headerSize;
+    unsigned long previous_ms = capture.start_ms;
+    Capture::FrameInfo info;
+
+    while (position < capture.bytes.size())
+    {
+      size_t size = Capture::decodeFrame(&capture.bytes[position], capture.bytes.size() - position, previous_ms, info, Signal::RawSignal);
+      if (size == 0)
+      {
+        fprintf(stderr, "truncated or malformed frame at byte %zu\n", position);
+        return false;
+      }
+      handle(info);
+      previous_ms = info.time_ms;
+      position += size;
+    }
+    return true;
+  }
+
+  int info(const Recording &capture)
+  {
+    printf("recording started at millis() %lu", capture.start_ms);
+    if (capture.unixTime_s)
+    {
+      time_t start = capture.unixTime_s;
+      char date[32];
+      strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S UTC", gmtime(&start));
+      printf(", %s", date);
+    }
+    printf("\n      ms  slicer            end reason                rssi  pulses\n");
+
+    unsigned long frames = 0, pulses = 0;
+    bool complete = forEachFrame(capture, [&](const Capture::FrameInfo &info) {
+      const auto &signal = Signal::RawSignal;
+      printf("%8lu  %-16s  %-24s  %4d  %6d\n", info.time_ms - capture.start_ms, slicerName(info.slicer),
+             Signal::endReasonToString(info.endReason), (int)signal.rssi, signal.Number);
+      frames++;
+      pulses += signal.Number;
+    });
+    printf("%lu frames, %lu pulses, %zu bytes (%.2f bytes per pulse)\n", frames, pulses, capture.bytes.size(),
+           pulses ? (double)capture.bytes.size() / pulses : 0.0);
+    return complete ? 0 : 1;
+  }
+
+  int vcd(const Recording &capture)
+  {
+    printf("$version RFLink32 capture $end\n$timescale 1us $end\n");
+    printf("$scope module rflink $end\n$var wire 1 ! rx_data $end\n$upscope $end\n$enddefinitions $end\n");
+    printf("#0\n0!\n");
+
+    unsigned long long end_us = 0; // end of the previous frame
+    bool complete = forEachFrame(capture, [&](const Capture::FrameInfo &info) {
+      const auto &signal = Signal::RawSignal;
+      unsigned long long t = (unsigned long long)(info.time_ms - capture.start_ms) * 1000;
+      if (t < end_us + 1000) // frames are timed in ms, keep them apart
+        t = end_us + 1000;
+
+      for (int i = 1; i <= signal.Number; i++)
+      {
+        printf("#%llu\n%c!\n", t, (i % 2) ? '1' : '0');
+        t += (unsigned long)signal.Pulses[i] * signal.Multiply;
+      }
+      printf("#%llu\n0!\n", t);
+      end_us = t;
+    });
+    printf("#%llu\n", end_us + 1000);
+    return complete ? 0 : 1;
+  }
+
+  int replay(const Recording &capture)
+  {
+    unsigned long frames = 0, decoded = 0;
+    bool complete = forEachFrame(capture, [&](const Capture::FrameInfo &info) {
+      if (info.slicer == CAPTURE_SLICER_UNKNOWN) // converted from a debug log, untimed: one frame per second
+        Native::setMicros(frames * 1000000UL);
+      else
+        Native::setMicros((info.time_ms - capture.start_ms) * 1000);
+      Signal::RawSignal.Time = millis();
+      printf("# %lu ms, %d pulses, %s\n", info.time_ms - capture.start_ms, Signal::RawSignal.Number, slicerName(info.slicer));
+      frames++;
+      if (Native::decodeRawSignal())
+        decoded++;
+    });
+    fprintf(stderr, "%lu frames, %lu decoded\n", frames, decoded);
+    return complete ? 0 : 1;
+  }
+
+  int convert(const char *inputPath, const char *outputPath)
+  {
+    Recording capture;
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[CAPTURE_FRAME_MAX_SIZE];
+
+    FILE *input = fopen(inputPath, "r");
+    if (!input)
+    {
+      perror(inputPath);
+      return 2;
+    }
+    bool streamed = false;
+    static char line[16384];
+    while (!streamed && fgets(line, sizeof(line), input))
+      streamed = strstr(line, "CAPTURE;Header=") != nullptr;
+    fclose(input);
+
+    if (streamed)
+    {
+      if (!load(inputPath, capture))
+        return 2;
+      bytes = capture.bytes;
+    }
+    else
+    {
+      // debug lines carry neither time nor slicer
+      bytes.assign(buffer, buffer + Capture::encodeHeader(buffer, 0, 0));
+      input = fopen(inputPath, "r");
+      while (fgets(line, sizeof(line), input))
+      {
+        if (!Native::loadPulses(line, Signal::RawSignal))
+          continue;
+        const char *rssi = strstr(line, ";RSSI=");
+        Signal::RawSignal.rssi = rssi ? atoi(rssi + strlen(";RSSI=")) : 0;
+        Signal::RawSignal.Time = 0;
+        bytes.insert(bytes.end(), buffer, buffer + Capture::encodeFrame(buffer, Signal::RawSignal, CAPTURE_SLICER_UNKNOWN, 0));
+      }
+      fclose(input);
+    }
+
+    FILE *output = fopen(outputPath, "wb");
+    if (!output || fwrite(bytes.data(), 1, bytes.size(), output) != bytes.size())
+    {
+      perror(outputPath);
+      return 2;
+    }
+    fclose(output);
+    return 0;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  Native::setSerialOutput(nullptr);
+  Native::setMessageSink(printMessage);
+  Native::setup();
+  Native::setMicros(0);
+
+  if (argc == 4 && strcmp(argv[1], "convert") == 0)
+    return convert(argv[2], argv[3]);
+
+  Recording capture;
+  if (argc == 3 && strcmp(argv[1], "info") == 0)
+    return load(argv[2], capture) ? info(capture) : 2;
+  if (argc == 3 && strcmp(argv[1], "vcd") == 0)
+    return load(argv[2], capture) ? vcd(capture) : 2;
+  if (argc == 3 && strcmp(argv[1], "replay") == 0)
+    return load(argv[2], capture) ? replay(capture) : 2;
+
+  fprintf(stderr, "usage: %s info|vcd|replay capture | convert log capture.rfc\n", argv[0]);
+  return 2;
+}
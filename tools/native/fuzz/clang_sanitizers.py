@@ -0,0 +1,8 @@
+# PlatformIO pre script of env:native_fuzz: libFuzzer comes with clang only, and the sanitizers
+# must be given to the linker too
+Import("env")
+
+sanitizers = ["-fsanitize=fuzzer,address,undefined", "-fno-omit-frame-pointer"]
+
+env.Replace(CC="clang", CXX="clang++", LINK="clang++")
+env.Append(CCFLAGS=sanitizers, LINKFLAGS=sanitizers)
@@ -0,0 +1,155 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// libFuzzer target for the receive plugins: every input becomes a RawSignal, two bytes per pulse
+// (little endian, microseconds), which goes through PluginRXCall() and the display_* functions.
+//
+//   pio run -e native_fuzz
+//   .pio/build/native_fuzz/program -max_len=2400 corpus_dir
+//
+// Pulses past RawSignal.Number are poisoned under AddressSanitizer, so that plugins reading or writing
+// beyond the received frame are caught even though RawSignal.Pulses itself is larger.
+// Every plugin call is timed by the plugin statistics of 5_Plugin.cpp: a new longest call is reported
+// on stderr, and if RFLINK_FUZZ_PLUGIN_LIMIT_US is set in the environment, a call longer than that
+// aborts so that libFuzzer keeps the input. Statistics of all plugins are printed on exit.
+//
+// Without libFuzzer (gcc), build with -D RFLINK_FUZZ_STANDALONE: inputs given as files are replayed,
+// or random ones are generated with -n count.
+
+#include <Arduino.h>
+#include <sanitizer/asan_interface.h>
+#include "2_Signal.h"
+#include "5_Plugin.h"
+#include "RFLinkNative.h"
+
+using namespace RFLink;
+
+#ifdef RFLINK_PLUGIN_STATS_DISABLED
+#error "the fuzzing harness relies on plugin statistics"
+#endif
+
+namespace
+{
+  unsigned long pluginLimit_us = 0;
+  unsigned long longestCall_us[PLUGIN_MAX];
+
+  void discardMessage(const char *) {}
+
+  void printStats()
+  {
+    fprintf(stderr, "plugin       calls  matches  avg us  max us\n");
+    for (byte x = 0; x < PLUGIN_MAX; x++)
+    {
+      const auto &stats = Plugin::counters::stats[x];
+      if (stats.calls == 0)
+        continue;
+      fprintf(stderr, "  %03u  %10lu  %7lu  %6.1f  %6lu\n", Plugin_id[x], stats.calls, stats.matches,
+              (double)stats.totalTime_us / stats.calls, stats.maxTime_us);
+    }
+  }
+
+  void checkPluginTimes(int number)
+  {
+    for (byte x = 0; x < PLUGIN_MAX; x++)
+    {
+      unsigned long max_us = Plugin::counters::stats[x].maxTime_us;
+      if (max_us <= longestCall_us[x])
+        continue;
+
+      longestCall_us[x] = max_us;
+      fprintf(stderr, "plugin %03u: longest call so far %lu us, on %d pulses\n", Plugin_id[x], max_us, number);
+      if (pluginLimit_us != 0 && max_us > pluginLimit_us)
+      {
+        fprintf(stderr, "plugin %03u: over the %lu us limit\n", Plugin_id[x], pluginLimit_us);
+        abort();
+      }
+    }
+  }
+}
+
+extern "C" int LLVMFuzzerInitialize(int *, char ***)
+{
+  const char *limit = getenv("RFLINK_FUZZ_PLUGIN_LIMIT_US");
+  if (limit)
+    pluginLimit_us = strtoul(limit, nullptr, 10);
+
+  Native::setSerialOutput(nullptr);
+  Native::setMessageSink(discardMessage);
+  Native::setup();
+  atexit(printStats);
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  auto &signal = Signal::RawSignal;
+
+  int number = size / 2;
+  if (number > RAW_BUFFER_SIZE)
+    number = RAW_BUFFER_SIZE;
+
+  signal.Number = number;
+  signal.Repeats = 0;
+  signal.Delay = 0;
+  signal.Multiply = Signal::params::sample_rate;
+  signal.Time = millis();
+  signal.rssi = -50;
+  signal.endReason = Signal::EndReasons::Unknown;
+  for (int i = 1; i <= number; i++)
+    signal.Pulses[i] = data[2 * i - 2] | (data[2 * i - 1] << 8);
+
+  uint16_t *end = &signal.Pulses[number + 1];
+  size_t tailSize = (RAW_BUFFER_SIZE - number) * sizeof(signal.Pulses[0]);
+  ASAN_POISON_MEMORY_REGION(end, tailSize);
+  Native::decodeRawSignal();
+  ASAN_UNPOISON_MEMORY_REGION(end, tailSize);
+
+  checkPluginTimes(number);
+  return 0;
+}
+
+#ifdef RFLINK_FUZZ_STANDALONE
+int main(int argc, char **argv)
+{
+  LLVMFuzzerInitialize(&argc, &argv);
+
+  static uint8_t data[2 * RAW_BUFFER_SIZE + 2];
+
+  if (argc == 3 && strcmp(argv[1], "-n") == 0)
+  {
+    // random frames of random pulse counts, with widths around the usual ones
+    unsigned long count = strtoul(argv[2], nullptr, 10);
+    srand(1);
+    for (unsigned long n = 0; n < count; n++)
+    {
+      size_t size = 2 * (rand() % (RAW_BUFFER_SIZE + 1));
+      uint16_t base = 100 + rand() % 2000;
+      for (size_t i = 0; i < size; i += 2)
+      {
+        uint16_t pulse = (rand() % 4 == 0) ? rand() % 10000 : base * (1 + rand() % 4);
+        data[i] = pulse & 0xff;
+        data[i + 1] = pulse >> 8;
+      }
+      LLVMFuzzerTestOneInput(data, size);
+    }
+    return 0;
+  }
+
+  for (int i = 1; i < argc; i++)
+  {
+    FILE *input = fopen(argv[i], "rb");
+    if (!input)
+    {
+      perror(argv[i]);
+      return 2;
+    }
+    size_t size = fread(data, 1, sizeof(data), input);
+    fclose(input);
+    LLVMFuzzerTestOneInput(data, size);
+  }
+  return 0;
+}
+#endif
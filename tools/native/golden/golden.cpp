@@ -0,0 +1,201 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Golden output regression: pairs of captures and of the messages they must produce, replayed through
+// PluginRXCall() and the display_* functions.
+//
+//   .pio/build/native_golden/program record corpus ... > tools/native/golden/plugins.golden
+//   .pio/build/native_golden/program check tools/native/golden/plugins.golden
+//
+// record decodes corpora read like tools/native/src/main.cpp does (plugin sources included) and writes
+// every capture followed by its messages. check replays such a file, prints the differences and
+// exits with 1 if there is any. Sequence numbers are written as XX, captures that no plugin
+// decodes are kept with "= -" so that false positives show up too. check also fails when RawSignal
+// is not left as received by PluginRXCall(), bursts split in sub-frames included.
+
+#include <string>
+#include <string.h>
+#include <Arduino.h> // after the standard headers, its min() and max() macros break them
+#include "2_Signal.h"
+#include "5_Plugin.h"
+#include "RFLinkNative.h"
+
+using namespace RFLink;
+
+namespace
+{
+  std::string messages;
+  bool frameAltered;
+
+  void collectMessage(const char *message)
+  {
+    messages += message;
+  }
+
+  /**
+   * Decodes the capture in RawSignal as a new transmission
+   * @return the messages, one per line starting with "= ", sequence numbers replaced by XX
+   * */
+  std::string decode()
+  {
+    // some plugins suppress repeats on their own
+    Native::advanceMicros(1000000UL);
+    Signal::RawSignal.Time = millis();
+
+    static Signal::RawSignalStruct received;
+    memcpy(&received, &Signal::RawSignal, sizeof(received));
+    messages.clear();
+    bool decoded = Native::decodeRawSignal();
+    frameAltered = received.Number != Signal::RawSignal.Number ||
+                   memcmp(received.Pulses, Signal::RawSignal.Pulses, sizeof(received.Pulses)) != 0;
+    if (!decoded)
+      return "= -\n";
+
+    std::string result;
+    size_t start = 0;
+    while (start < messages.size())
+    {
+      size_t end = messages.find_first_of("\r\n", start);
+      if (end == std::string::npos)
+        end = messages.size();
+      std::string line = messages.substr(start, end - start);
+      if (line.size() > 6 && line.compare(0, 3, "20;") == 0 && line[5] == ';')
+        line.replace(3, 2, "XX");
+      if (!line.empty())
+        result += "= " + line + "\n";
+      start = end + 1;
+    }
+    return result;
+  }
+
+  std::string captureLine(const Signal::RawSignalStruct &signal)
+  {
+    std::string line = "20;XX;DEBUG;Pulses=" + std::to_string(signal.Number) + ";Pulses(uSec)=";
+    for (int i = 1; i <= signal.Number; i++)
+    {
+      line += std::to_string((unsigned long)signal.Pulses[i] * signal.Multiply);
+      line += i < signal.Number ? "," : ";";
+    }
+    return line;
+  }
+
+  int record(int argc, char **argv)
+  {
+    printf("# Golden outputs of the plugins, see tools/native/README.md\n");
+
+    for (int i = 0; i < argc; i++)
+    {
+      FILE *input = fopen(argv[i], "r");
+      if (!input)
+      {
+        perror(argv[i]);
+        return 2;
+      }
+
+      const char *name = strrchr(argv[i], '/');
+      bool first = true;
+      static char line[16384];
+      while (fgets(line, sizeof(line), input))
+      {
+        if (!Native::loadPulses(line, Signal::RawSignal))
+          continue;
+        if (first)
+          printf("\n# %s\n", name ? name + 1 : argv[i]);
+        first = false;
+
+        printf("%s\n", captureLine(Signal::RawSignal).c_str());
+        fputs(decode().c_str(), stdout);
+      }
+      fclose(input);
+    }
+    return 0;
+  }
+
+  int check(const char *path)
+  {
+    FILE *input = fopen(path, "r");
+    if (!input)
+    {
+      perror(path);
+      return 2;
+    }
+
+    bool covered[256] = {false};
+    unsigned long captures = 0, mismatches = 0, altered = 0;
+    unsigned long lineNumber = 0, captureLineNumber = 0;
+    std::string expected, got;
+    bool pending = false;
+
+    auto compare = [&]() {
+      if (!pending)
+        return;
+      if (expected != got)
+      {
+        mismatches++;
+        printf("%s:%lu: expected\n%s%s:%lu: got\n%s", path, captureLineNumber, expected.c_str(), path, captureLineNumber, got.c_str());
+      }
+      pending = false;
+    };
+
+    static char line[16384];
+    while (fgets(line, sizeof(line), input))
+    {
+      lineNumber++;
+      if (line[0] == '=')
+      {
+        expected += line;
+        continue;
+      }
+      compare();
+      if (line[0] == '#' || !Native::loadPulses(line, Signal::RawSignal))
+        continue;
+
+      captures++;
+      captureLineNumber = lineNumber;
+      got = decode();
+      covered[DispatchResult.decodedBy] = true;
+      if (frameAltered)
+      {
+        altered++;
+        printf("%s:%lu: RawSignal changed by PluginRXCall()\n", path, lineNumber);
+      }
+      expected.clear();
+      pending = true;
+    }
+    compare();
+    fclose(input);
+
+    printf("%lu captures, %lu mismatches, %lu frames altered\n", captures, mismatches, altered);
+    printf("enabled plugins without golden output:");
+    for (byte x = 0; x < PLUGIN_MAX; x++)
+    {
+      if (Plugin_id[x] != 0 && Plugin_State[x] >= P_Enabled && !covered[Plugin_id[x]])
+        printf(" %03u", Plugin_id[x]);
+    }
+    printf("\n");
+
+    return mismatches || altered ? 1 : 0;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  Native::setSerialOutput(nullptr);
+  Native::setMessageSink(collectMessage);
+  Native::setup();
+  Native::setMicros(0);
+  // outputs must not depend on the captures decoded before
+  Plugin::params::adaptive_order = false;
+  Plugin::updateOrder();
+
+  if (argc >= 3 && strcmp(argv[1], "record") == 0)
+    return record(argc - 2, argv + 2);
+  if (argc == 3 && strcmp(argv[1], "check") == 0)
+    return check(argv[2]);
+
+  fprintf(stderr, "usage: %s record corpus ... | check file.golden\n", argv[0]);
+  return 2;
+}
@@ -0,0 +1,409 @@
+#!/usr/bin/env python3
+# Writes synthetic captures for the plugins that the sample captures in the plugin sources do not cover,
+# each preceded by a comment telling what it encodes. See tools/native/README.md.
+#
+#   python3 tools/native/golden/synthesize.py > tools/native/golden/synthesized.txt
+
+out = []
+
+def emit(desc, pulses):
+    out.append("# " + desc)
+    out.append("20;XX;DEBUG;Pulses=%d;Pulses(uSec)=%s;" % (len(pulses), ",".join(str(p) for p in pulses)))
+
+def bits(value, n):
+    return [(value >> (n - 1 - i)) & 1 for i in range(n)]
+
+def nibbles_to_bits(nibs):
+    r = []
+    for n in nibs:
+        r += bits(n, 4)
+    return r
+
+def crc8(data, poly, init=0):
+    r = init
+    for b in data:
+        r ^= b
+        for _ in range(8):
+            r = ((r << 1) ^ poly) & 0xFF if r & 0x80 else (r << 1) & 0xFF
+    return r
+
+def reverse8(v):
+    return int("{:08b}".format(v)[::-1], 2)
+
+def crc8le(data, poly, init=0):
+    r = reverse8(init)
+    poly = reverse8(poly)
+    for b in data:
+        r ^= b
+        for _ in range(8):
+            r = (r >> 1) ^ poly if r & 1 else r >> 1
+    return r
+
+def bytes_bits(data, n=None):
+    r = []
+    for b in data:
+        r += bits(b, 8)
+    return r if n is None else r[:n]
+
+# 002 LaCrosse V2: mark short = 1, long = 0, spaces 1300
+def lacrosse_v2(nibs):
+    nibs = nibs + [sum(nibs) & 0xF]
+    p = []
+    for b in nibbles_to_bits(nibs):
+        p += [500 if b else 1300, 1300]
+    return p
+
+# WS2300 temperature 21.5: 215 + 300 = 515
+emit("002 LaCrosse V2: WS2300 temperature, ID 4C, 21.5 C", lacrosse_v2([0, 9, 0, 4, 0xC, 0, 0, 5, 1, 5, 0, 0]))
+
+# 004 NewKaku: start, 8T, 32 bits of T,T,T,4T (0) or T,4T,T,T (1), stop
+def newkaku(value, dim=None):
+    T = 275
+    p = [T, 2675]
+    for b in bits(value, 32):
+        p += [T, 1250, T, T] if b else [T, T, T, 1250]
+    if dim is not None:
+        for b in bits(dim, 4):
+            p += [T, 1250, T, T] if b else [T, T, T, 1250]
+    return p + [T, 10000]
+
+emit("004 NewKaku: address 0x0123456, unit 3, on", newkaku((0x0123456 << 6) | (0 << 5) | (1 << 4) | 2))
+emit("004 NewKaku: address 0x0123456, group off", newkaku((0x0123456 << 6) | (1 << 5) | (0 << 4) | 0))
+
+# 005 Eurodomest: 24 bits, 1 = short mark + long space, 0 = long mark + short space, short stop pulse
+def eurodomest(value):
+    p = []
+    for b in bits(value, 24):
+        p += [275, 800] if b else [800, 275]
+    return p + [275, 6000]
+
+emit("005 Eurodomest: address 0x2a5c3, unit 1, on", eurodomest((0x2a5c3 << 4) | (1 << 1) | 0))
+
+# 009 X10: 32 bits on the even pulses, long = 1, each byte is followed by its complement
+def x10(house, command):
+    p = [500]
+    for b in bytes_bits([house, house ^ 0xFF, command, command ^ 0xFF]):
+        p += [1700 if b else 500, 500]
+    return p + [9000]
+
+emit("009 X10: house A, unit 1 on", x10(0x60, 0x00))
+emit("009 X10: house A, unit 1 off", x10(0x60, 0x20))
+
+# 010 TRC02RGB: a start pulse, then 32 bits where a long pulse flips the bit value and two short pulses repeat it;
+# a long pulse or a short pair after the data tells the parity of the short pairs.
+# The plugin also checks that the third pulse is 1200-1500, so the start pulse sits there.
+def trc02(value):
+    p = [500, 500, 1400]
+    mask = 0
+    parity = 0
+    for b in bits(value, 32):
+        if b == 1 - mask:
+            p += [500, 500]
+            parity ^= 1
+        else:
+            p += [900]
+            mask = 1 - mask
+    p += [900] if parity else [500, 500]
+    while len(p) < 179:
+        p.append(500)
+    return p + [9000]
+
+emit("010 TRC02RGB: ID 0x5a3c96, on", trc02(0x5A3C9601))
+emit("010 TRC02RGB: ID 0x5a3c96, dim up", trc02(0x5A3C9603))
+
+# 012 FA500 method 3: 12 manchester bits on the even pulses, long = 1
+def fa500(value):
+    p = []
+    for b in bits(value, 12):
+        p += [300, 900] if b else [900, 300]
+    return p + [300, 8000]
+
+emit("012 FA500: housecode A, unit 0x0a, on", fa500((1 << 8) | (0x0A << 1) | 1))
+
+# 015 HomeEasy: 58 bits, 1 = short + long, 0 = long + short, preamble 0x63c, 32 bits address, 14 bits command
+def homeeasy(preamble, address, command):
+    p = []
+    for b in bits(preamble, 11) + bits(address, 32) + bits(command, 14) + [1]:
+        p += [300, 900] if b else [900, 300]
+    p[-1] = 10000
+    return p
+
+emit("015 HomeEasy: HE301, address 0x5a5a1234, channel 5, on", homeeasy(0x63C, 0x5A5A1234, (3 << 12) | 5))
+
+# 016 Silvercrest: packets of 24 PWM bits (long mark = 1) between gaps on even pulses, repeated
+def silvercrest(value):
+    p = []
+    for _ in range(4):
+        for b in bits(value, 24):
+            p += [1100, 400] if b else [400, 1100]
+        p += [400, 3000]
+    return p
+
+emit("016 Silvercrest: remote 0xb, button 0, on code 0xf756", silvercrest(0xBF7560))
+
+# 018 Louvolite: 65 PWM bits (long mark = 1), header 0xac, byte 7 is the sum of bytes 1 to 6
+def louvolite(uuid, node, cmd):
+    data = [0xAC, (uuid >> 16) & 0xFF, (uuid >> 8) & 0xFF, uuid & 0xFF, node, cmd >> 8, cmd & 0xFF]
+    data.append(sum(data[1:]) & 0xFF)
+    p = []
+    for b in bytes_bits(data) + [1]:
+        p += [650, 275] if b else [275, 650]
+    p[-1] = 4750
+    return p
+
+emit("018 Louvolite: remote 0x123456, channel 2, up", louvolite(0x123456, 2, 0x000B))
+emit("018 Louvolite: remote 0x123456, channel 2, down", louvolite(0x123456, 2, 0x0043))
+
+# 029 Alecto V2: 8 bits header then 9 bytes, short mark = 1, last byte crc8 0x31
+def alecto_v2(data):
+    data = data + [crc8(data, 0x31)]
+    p = []
+    for b in [1, 0, 1, 0, 1, 0, 1, 0] + bytes_bits(data):
+        p += [400, 1000] if b else [1400, 1000]
+    return p
+
+emit("029 Alecto V2: rolling code 0xa5c, 21.5 C, 55 %", alecto_v2([0xA5, 0xC0 | ((615 >> 8) & 3), 615 & 0xFF, 55, 10, 20, 0, 100]))
+
+# 030 Alecto V1: 32 bits then a 4 bits checksum on the even pulses, long = 1, LSB first
+def alecto_v1(nibs):
+    checksum = (0xF - sum(nibs)) & 0xF
+    p = [500]
+    for n in nibs + [checksum]:
+        for i in range(4):
+            p += [3900 if (n >> i) & 1 else 1900, 500]
+    return p + [9000]
+
+emit("030 Alecto V1: rolling code 0xa5, 21.5 C, 45 %", alecto_v1([5, 0xA, 0, 7, 0xD, 0, 5, 4]))
+
+# 031 Alecto V3: WS1100, 32 bits from pulse 15 then the crc8 0x31 byte, short mark = 1
+def alecto_v3(value):
+    data = [(value >> 24) & 0xFF, (value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF]
+    p = [500, 900] * 7
+    for b in bytes_bits(data + [crc8(data, 0x31)]):
+        p += [200 if b else 500, 900]
+    p[-1] = 9000
+    return p
+
+emit("031 Alecto V3: WS1100, rolling code 0x5a, 15.5 C, 55 %", alecto_v3((0x1 << 28) | (0x5A << 20) | (555 << 8) | 55))
+
+# 032 Alecto V4: 28 bits then 8 bits humidity on the even pulses, long = 1
+def alecto_v4(value, humidity):
+    p = [500]
+    for b in bits(value, 28) + bits(humidity, 8):
+        p += [4000 if b else 2000, 500]
+    return p + [9000]
+
+emit("032 Alecto V4: rolling code 0x5a, 21.5 C, 45 %", alecto_v4((0x5A << 20) | (0x30 << 12) | 215, 45))
+
+# 034 Cresta: bytes sent LSB first with an even parity bit, 1 = one long pulse, 0 = two short pulses
+def cresta(data):
+    data = data + [0]
+    x = 0
+    for b in data[1:-1]:
+        x ^= b
+    data[-1] = x
+    p = []
+    for byte in data + [0] * 4:
+        symbols = [(byte >> i) & 1 for i in range(8)]
+        symbols.append(sum(symbols) & 1)
+        for b in symbols:
+            p += [1000] if b else [500, 500]
+    return p
+
+emit("034 Cresta: thermo/hygro, ID 0x25, 21.5 C, 55 %", cresta([0x9F, 0x25, 6 << 1, 0x1E, 0x15, 0x82, 55]))
+
+# 036 F007_TH: 51 manchester bits from pulse 2, short + short keeps the bit value, long inverts it
+def f007_th(rolling, battery, channel, temperature, humidity):
+    data = (rolling << 24) | (battery << 23) | (channel << 20) | (temperature << 8) | humidity
+    values = bits(0x3FEA2, 18) + [0] + bits(data, 32)
+    p = [500]
+    last = 1
+    for v in values:
+        p += [500, 500] if v == last else [1000]
+        last = v
+    while len(p) < 111:
+        p.append(500)
+    return p
+
+emit("036 F007_TH: rolling code 0x5a, channel 2, 21.5 C, 55 %", f007_th(0x5A, 0, 2, 1107, 55))
+
+# 037 AcuRite 986: 4 bytes then crc8le 0x07 on the odd pulses, LSB first, long = 1
+def acurite(data):
+    p = []
+    for byte in data + [crc8le(data, 0x07)]:
+        for i in range(8):
+            p += [1000 if (byte >> i) & 1 else 400, 500]
+    return p + [400, 500, 400, 9000]
+
+emit("037 AcuRite 986: ID 0x1234, unit 1, 71 F", acurite([71, 0x12, 0x34, 0x00]))
+
+# 040 Mebus: 28 bits on the even pulses, long = 1, the first nibble is the checksum of the other six
+def mebus(nibs):
+    nibs = [(sum(nibs) - 1) & 0xF] + nibs
+    p = [500]
+    for b in nibbles_to_bits(nibs):
+        p += [3900 if b else 1900, 500]
+    return p + [9000]
+
+emit("040 Mebus: ID 0x5a, channel 1, 21.5 C", mebus([5, 0xA, 0, 0xD, 7, 1 << 2]))
+
+# 044 Auriol V3: 40 bits on the even pulses, long = 1, crc4 0x13 with the channel bits in the crc position
+def crc4(data, poly, init=0):
+    r = init << 4
+    poly <<= 4
+    for b in data:
+        r ^= b
+        for _ in range(8):
+            r = (r << 1) ^ poly if r & 0x80 else r << 1
+    return (r >> 4) & 0xF
+
+def auriol_v3(rc, battery_low, temp_raw, hum_bcd, channel):
+    data = [rc, battery_low << 2, temp_raw >> 4, ((temp_raw & 0xF) << 4) | (hum_bcd >> 4), ((hum_bcd & 0xF) << 4) | channel]
+    msg = data[:4]
+    msg[1] = (msg[1] & 0x0F) | (data[4] & 0x0F) << 4
+    data[1] |= (crc4(msg, 0x13) ^ (data[4] >> 4)) << 4
+    p = [500]
+    for b in bytes_bits(data):
+        p += [3900 if b else 1800, 500]
+    return p + [9000]
+
+# 21.5 C: (1607 - 0x4c4) * 5 / 9 = 215
+emit("044 Auriol V3: rolling code 0x5a, channel 1, 21.5 C, 55 %", auriol_v3(0x5A, 0, 1607, 0x55, 1))
+
+# 045 Auriol: 32 bits on the even pulses, long = 1, the last bit is the parity of the others
+def auriol(rc, bat, temp):
+    value = (rc << 24) | (bat << 23) | (temp << 8)
+    parity = 0
+    for i in range(1, 32):
+        parity ^= (value >> i) & 1
+    p = [500]
+    for b in bits(value | parity, 32):
+        p += [3900 if b else 1900, 500]
+    return p + [9000]
+
+emit("045 Auriol: rolling code 0xa5, 21.5 C", auriol(0xA5, 1, 215))
+emit("045 Auriol: rolling code 0xa5, -5.0 C", auriol(0xA5, 1, 4096 - 50))
+
+# 049 LaCrosse TX141: four preamble pairs of 800, then PWM bits, 1 = long mark then short space
+def tx141(value, nbits):
+    p = [800] * 8
+    for b in bits(value, nbits):
+        p += [500, 250] if b else [250, 500]
+    return p + [250, 9000]
+
+# TX141Bv2 is 37 bits: ID, battery, 3 unused bits, temperature + 500, then 13 bits that are not decoded
+emit("049 LaCrosse TX141Bv2: ID 0x5a, 21.5 C", tx141((0x5A << 29) | (1 << 28) | (715 << 13), 37))
+
+def lfsr_digest8_reflect(data, gen, key):
+    total = 0
+    for byte in reversed(data):
+        for i in range(8):
+            if (byte >> i) & 1:
+                total ^= key
+            key = ((key << 1) ^ gen) & 0xFF if key & 0x80 else (key << 1) & 0xFF
+    return total
+
+# TX141TH-Bv2 is 40 bits: the same layout with humidity, then an LFSR digest of the first four bytes
+def tx141th(sensor_id, battery, temp, hum):
+    data = [sensor_id, (battery << 7) | (temp >> 8), temp & 0xFF, hum]
+    return tx141(int.from_bytes(bytes(data + [lfsr_digest8_reflect(data, 0x31, 0xF4)]), "big"), 40)
+
+emit("049 LaCrosse TX141TH-Bv2: ID 0xa5, 21.5 C, 55 %", tx141th(0xA5, 0, 715, 55))
+
+# 060 Ajax Chubb: short start pulse then 12 bits, 1 = short mark then long space, 0 = long mark then short space
+def ajax(value):
+    p = [400]
+    for b in bits(value, 12):
+        p += [400, 850] if b else [850, 400]
+    return p + [5000]
+
+emit("060 Ajax Chubb motion sensor: 12 bits 0x9a5", ajax(0x9A5))
+
+# 061 EV1527: 24 bits, 1 = long space then short mark, 0 = short space then long mark
+# A long 49th pulse keeps plugin 005 (Eurodomest), which has the same bit coding, from taking the frame
+def ev1527(value):
+    p = []
+    for b in bits(value, 24):
+        p += [900, 300] if b else [300, 900]
+    return p + [2000, 9000]
+
+emit("061 EV1527: ID 0x12345, button 6", ev1527(0x123456))
+
+# 070 SelectPlus: 17 bits, 1 = long mark then short space, 0 = short mark then long space, the last nibble is 0
+def selectplus(value):
+    p = [400]
+    for b in bits(value, 17):
+        p += [1200, 400] if b else [400, 1200]
+    return p + [6000]
+
+emit("070 SelectPlus doorbell: ID 0x0a5c", selectplus(0x0A5C << 4))
+
+# 071 Plieger doorbell: 32 bits from the first pulse, 1 = long mark then short space, ID, 8 zero bits, chime code
+def plieger(sensor_id, chime):
+    p = []
+    for b in bits((sensor_id << 16) | chime, 32):
+        p += [1200, 400] if b else [400, 1200]
+    return p + [400, 9000]
+
+emit("071 Plieger doorbell: ID 0x5a3c, chime 1", plieger(0x5A3C, 0xE0))
+
+# 072 Byron SX: 12 bits, 0 = short mark then long space, 1 = long mark then short space.
+# Plugin 072 only decodes frames that plugin 001 hands over, so a raw Byron frame stays undecoded.
+def byron(value):
+    p = [300]
+    for b in bits(value, 12):
+        p += [550, 250] if b else [250, 500]
+    return p + [3000]
+
+emit("072 Byron SX: ID 0x5a, chime 3, not handed over by plugin 001", byron(0x5A3))
+
+# 073 Deltronic: 12 bits, eight 1s then the ID, 1 = long mark then short space
+# The 1200 long mark is too long for plugin 060, which shares the bit coding
+def deltronic(value):
+    p = [400]
+    for b in bits(0xFF0 | value, 12):
+        p += [1200, 400] if b else [400, 1200]
+    return p + [6000]
+
+emit("073 Deltronic doorbell: ID 5", deltronic(5))
+
+# 074 Byron MP: 12 bits LSB first, 0 = short long short long, 1 = short long long short, the low 11 bits are 0x7ad
+def byron_mp(value):
+    p = []
+    for i in range(12):
+        p += [120, 400, 400, 120] if (value >> i) & 1 else [120, 400, 120, 400]
+    return p + [2000, 9000]
+
+emit("074 Byron MP: ring button", byron_mp(0x7AD))
+emit("074 Byron MP: change chime button", byron_mp(0xFAD))
+
+# 075 SilverCrest doorbell: nine long pulses, then 41 bits on the even pulses, short = 1, the last 12 bits are 0
+def lidl(value):
+    p = [1200] * 9
+    for b in bits(value << 13, 41):
+        p += [300 if b else 900, 600]
+    return p[:-1]
+
+emit("075 SilverCrest doorbell: ID 0x5a3c96", lidl(0x5A3C96))
+
+# 080 FA20RF smoke detector: 24 bits on the even pulses, 1 = 2400, 0 = 1250, separated by 800
+def fa20rf(value):
+    p = [800]
+    for b in bits(value, 24):
+        p += [2400 if b else 1250, 800]
+    return p + [9000]
+
+emit("080 FA20RF smoke detector: ID 0x5a3c96", fa20rf(0x5A3C96))
+
+# 081/082 Mertik Maxitrol: two short start pulses then address and command, 1 = long mark then short space.
+# A leading 0 bit keeps plugin 060 from taking the 26 pulse frame.
+def mertik(value, nbits):
+    p = [300, 300]
+    for b in bits(value, nbits):
+        p += [750, 300] if b else [300, 750]
+    return p
+
+emit("081 Mertik: address 0x5a, up", mertik(0x5AB, 22))
+emit("082 Mertik v2: address 0x5a, down", mertik(0x5AD, 12))
+
+print("\n".join(out))
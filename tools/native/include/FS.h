@@ -0,0 +1,65 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Flash file system for the native build, files live in a host directory (see RFLinkNative.h)
+
+#ifndef FS_H
+#define FS_H
+
+#include <Arduino.h>
+
+namespace fs
+{
+  enum SeekMode
+  {
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+  };
+
+  class File : public Stream
+  {
+  private:
+    FILE *handle;
+
+  public:
+    File(FILE *handle = nullptr) : handle(handle) {}
+
+    operator bool() const { return handle != nullptr; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override { return handle ? fwrite(buffer, 1, size, handle) : 0; }
+    using Print::write;
+    size_t read(uint8_t *buffer, size_t size) { return handle ? fread(buffer, 1, size, handle) : 0; }
+    int read() override { return handle ? fgetc(handle) : -1; }
+    int peek() override;
+    int available() override;
+    bool seek(uint32_t position, SeekMode mode = SeekSet) { return handle && fseek(handle, position, mode) == 0; }
+    size_t position() const { return handle ? ftell(handle) : 0; }
+    size_t size() const;
+    void close();
+  };
+
+  class FS
+  {
+  public:
+    bool begin(bool formatOnFail = false);
+    void end() {}
+    File open(const char *path, const char *mode = "r");
+    bool exists(const char *path);
+    bool remove(const char *path);
+    bool rename(const char *pathFrom, const char *pathTo);
+  };
+}
+
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
+
+#endif // FS_H
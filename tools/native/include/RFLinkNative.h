@@ -0,0 +1,109 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#ifndef RFLinkNative_h
+#define RFLinkNative_h
+
+#include <Arduino.h>
+#include "2_Signal.h"
+
+namespace RFLink
+{
+  namespace Native
+  {
+    /**
+     * Host side controls of the native build, which runs Signal, Display, Plugins and Utils on a workstation
+     * against the thin Arduino core of tools/native/include. See tools/native/README.md
+     * */
+
+    /**
+     * Initialises the decoding path like RFLink::setup() does on the device: Signal parameters from
+     * their defaults, plugins and dispatch index. Must be called once before decoding.
+     * */
+    void setup();
+
+    /**
+     * micros() and millis() follow the host monotonic clock until setMicros() is called.
+     * From then on time only moves through advanceMicros(), delay() and delayMicroseconds(),
+     * so that simulations are reproducible.
+     * */
+    void setMicros(unsigned long now_us);
+    void advanceMicros(unsigned long duration_us);
+    void useHostClock();
+
+    /**
+     * With the manual clock, time spent by each micros() and digitalRead() call, as on the device.
+     * Busy loops polling the receiver only see time going by through these costs. Both are 0 by default.
+     * */
+    void setCallCosts(unsigned long micros_ns, unsigned long digitalRead_ns);
+
+    /**
+     * Sets the level read by digitalRead() on pin and calls the routine attached to it if the
+     * change matches its mode, as the GPIO interrupt would on the device.
+     * */
+    void setPinLevel(uint8_t pin, int level);
+
+    struct Edge
+    {
+      unsigned long time_us;
+      uint8_t level; // level from time_us on
+    };
+
+    /**
+     * With the manual clock, digitalRead(pin) returns the level of the timeline at the current time instead of the
+     * level set by setPinLevel(), so that the sync slicers can be run against it. Edges are sorted by time and must
+     * outlive the timeline, which nullptr removes. Interrupt routines are not called.
+     * */
+    void setPinTimeline(uint8_t pin, const Edge *edges, size_t count, int initialLevel = LOW);
+
+    /**
+     * Value returned by Radio::getCurrentRssi()
+     * */
+    void setRssi(float rssi);
+
+    /**
+     * Makes Radio::getCurrentRssi() return source(micros()), each call taking readCost_us with the manual clock.
+     * nullptr goes back to the value of setRssi().
+     * */
+    typedef float (*RssiSource)(unsigned long now_us);
+    void setRssiSource(RssiSource source, unsigned long readCost_us);
+
+    /**
+     * Host directory backing LittleFS, the current directory by default
+     * */
+    void setFileSystemRoot(const char *path);
+
+    /**
+     * Receives the text of each event leaving through RFLink::sendMsgFromBuffer(). Without a sink, messages
+     * are printed on Serial as on the device.
+     * */
+    typedef void (*MessageSink)(const char *message);
+    void setMessageSink(MessageSink sink);
+
+    /**
+     * Destination of everything printed on Serial, stdout by default, nullptr to discard it
+     * (plugins debug output, Serial.print calls in the decoding path).
+     * */
+    void setSerialOutput(FILE *stream);
+
+    /**
+     * Fills signal from a capture in text form: either a "20;XX;DEBUG;Pulses=n;Pulses(uSec)=..." line as printed by
+     * RFDebug, a "PROGMEM int temp[]={...}" array as kept in plugin sources, or a bare comma separated list of
+     * durations in microseconds. Pulses are divided by the current
+     * sample rate and Multiply is set accordingly, as for the testRF command.
+     * @return false if fewer than 2 pulses were found or if there are more than RAW_BUFFER_SIZE
+     * */
+    bool loadPulses(const char *text, Signal::RawSignalStruct &signal);
+
+    /**
+     * Runs RawSignal through the plugins like Signal::ScanEvent() does, then flushes the output buffer
+     * @return true if a plugin has decoded the signal
+     * */
+    bool decodeRawSignal();
+  }
+}
+
+#endif // RFLinkNative_h
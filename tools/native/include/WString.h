@@ -0,0 +1,161 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Arduino String for the native build, backed by std::string
+
+#ifndef WString_h
+#define WString_h
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <string>
+
+class __FlashStringHelper;
+
+class String
+{
+private:
+  std::string s;
+
+public:
+  String() {}
+  String(const char *cstr) : s(cstr ? cstr : "") {}
+  String(const __FlashStringHelper *str) : s(str ? reinterpret_cast<const char *>(str) : "") {}
+  String(const String &str) : s(str.s) {}
+  explicit String(char c) : s(1, c) {}
+  explicit String(unsigned char value, unsigned char base = 10) { fromUnsigned(value, base); }
+  explicit String(int value, unsigned char base = 10) { fromSigned(value, base); }
+  explicit String(unsigned int value, unsigned char base = 10) { fromUnsigned(value, base); }
+  explicit String(long value, unsigned char base = 10) { fromSigned(value, base); }
+  explicit String(unsigned long value, unsigned char base = 10) { fromUnsigned(value, base); }
+  explicit String(float value, unsigned char decimalPlaces = 2) { fromDouble(value, decimalPlaces); }
+  explicit String(double value, unsigned char decimalPlaces = 2) { fromDouble(value, decimalPlaces); }
+
+  String &operator=(const String &rhs) { s = rhs.s; return *this; }
+  String &operator=(const char *cstr) { s = cstr ? cstr : ""; return *this; }
+  String &operator=(const __FlashStringHelper *str) { return *this = reinterpret_cast<const char *>(str); }
+
+  bool reserve(unsigned int size) { s.reserve(size); return true; }
+  unsigned int length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  const char *c_str() const { return s.c_str(); }
+
+  bool concat(const String &str) { s += str.s; return true; }
+  bool concat(const char *cstr) { if (!cstr) return false; s += cstr; return true; }
+  bool concat(const __FlashStringHelper *str) { return concat(reinterpret_cast<const char *>(str)); }
+  bool concat(char c) { s += c; return true; }
+  bool concat(unsigned char value) { return concat(String(value)); }
+  bool concat(int value) { return concat(String(value)); }
+  bool concat(unsigned int value) { return concat(String(value)); }
+  bool concat(long value) { return concat(String(value)); }
+  bool concat(unsigned long value) { return concat(String(value)); }
+  bool concat(float value) { return concat(String(value)); }
+  bool concat(double value) { return concat(String(value)); }
+
+  template <typename T>
+  String &operator+=(const T &rhs) { concat(rhs); return *this; }
+
+  int compareTo(const String &str) const { return s.compare(str.s); }
+  bool equals(const String &str) const { return s == str.s; }
+  bool equals(const char *cstr) const { return s == (cstr ? cstr : ""); }
+  bool equalsIgnoreCase(const String &str) const { return strcasecmp(s.c_str(), str.c_str()) == 0; }
+  bool operator==(const String &rhs) const { return equals(rhs); }
+  bool operator==(const char *cstr) const { return equals(cstr); }
+  bool operator!=(const String &rhs) const { return !equals(rhs); }
+  bool operator!=(const char *cstr) const { return !equals(cstr); }
+  bool operator<(const String &rhs) const { return s < rhs.s; }
+  bool startsWith(const String &prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+  bool endsWith(const String &suffix) const { return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0; }
+
+  char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+  void setCharAt(unsigned int index, char c) { if (index < s.size()) s[index] = c; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char &operator[](unsigned int index) { return s[index]; }
+  void getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index = 0) const { toCharArray(reinterpret_cast<char *>(buf), bufsize, index); }
+  void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const
+  {
+    if (!bufsize || !buf)
+      return;
+    size_t n = index < s.size() ? s.copy(buf, bufsize - 1, index) : 0;
+    buf[n] = 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { size_t i = s.find(c, from); return i == std::string::npos ? -1 : (int)i; }
+  int indexOf(const String &str, unsigned int from = 0) const { size_t i = s.find(str.s, from); return i == std::string::npos ? -1 : (int)i; }
+  int lastIndexOf(char c) const { size_t i = s.rfind(c); return i == std::string::npos ? -1 : (int)i; }
+  String substring(unsigned int beginIndex) const { return beginIndex < s.size() ? String(s.substr(beginIndex).c_str()) : String(); }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const
+  {
+    if (beginIndex > endIndex)
+      return substring(endIndex, beginIndex);
+    return beginIndex < s.size() ? String(s.substr(beginIndex, endIndex - beginIndex).c_str()) : String();
+  }
+
+  void replace(char find, char replace) { for (size_t i = 0; i < s.size(); i++) if (s[i] == find) s[i] = replace; }
+  void replace(const String &find, const String &replace)
+  {
+    if (find.s.empty())
+      return;
+    for (size_t i = s.find(find.s); i != std::string::npos; i = s.find(find.s, i + replace.s.size()))
+      s.replace(i, find.s.size(), replace.s);
+  }
+  void remove(unsigned int index) { if (index < s.size()) s.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < s.size()) s.erase(index, count); }
+  void toLowerCase() { for (size_t i = 0; i < s.size(); i++) s[i] = tolower(s[i]); }
+  void toUpperCase() { for (size_t i = 0; i < s.size(); i++) s[i] = toupper(s[i]); }
+  void trim()
+  {
+    size_t first = s.find_first_not_of(" \t\r\n\f\v");
+    if (first == std::string::npos)
+      s.clear();
+    else
+      s = s.substr(first, s.find_last_not_of(" \t\r\n\f\v") - first + 1);
+  }
+
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return (float)atof(s.c_str()); }
+  double toDouble() const { return atof(s.c_str()); }
+
+private:
+  void fromSigned(long value, unsigned char base)
+  {
+    if (base != 10 || value >= 0)
+    {
+      fromUnsigned((unsigned long)value, base);
+      return;
+    }
+    fromUnsigned(0 - (unsigned long)value, base);
+    s.insert(0, 1, '-');
+  }
+  void fromUnsigned(unsigned long value, unsigned char base)
+  {
+    char buf[8 * sizeof(long) + 1];
+    char *p = buf + sizeof(buf) - 1;
+    *p = 0;
+    do
+    {
+      unsigned digit = value % base;
+      *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+      value /= base;
+    } while (value);
+    s = p;
+  }
+  void fromDouble(double value, unsigned char decimalPlaces)
+  {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+    s = buf;
+  }
+};
+
+inline String operator+(const String &lhs, const String &rhs) { String result(lhs); result.concat(rhs); return result; }
+inline String operator+(const String &lhs, const char *rhs) { String result(lhs); result.concat(rhs); return result; }
+inline String operator+(const char *lhs, const String &rhs) { String result(lhs); result.concat(rhs); return result; }
+inline String operator+(const String &lhs, char rhs) { String result(lhs); result.concat(rhs); return result; }
+
+#endif // WString_h
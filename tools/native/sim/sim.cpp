@@ -0,0 +1,641 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Edge timeline simulator: generates the receiver output of transmissions built from protocol templates,
+// with jitter, noise glitches, collisions and an RSSI trace, then runs every slicer of 2_Signal.cpp
+// against it through the fake clock and pin of the native build:
+//   - Legacy: FetchSignal_sync()
+//   - RSSI_Advanced: FetchSignal_sync_rssi()
+//   - Legacy_Resumable: ResumableSlicer::poll()
+//   - Resumable_Late: ResumableSlicer::feed() called on edges only, as when poll() is resumed too late to
+//     see the timeout: every frame ends on the first edge after its trailing gap
+//   - Async: RX_pin_changed_state() called on every edge, frames popped as ScanEvent() does
+//
+//   .pio/build/native_sim/program [options]
+//     -n count        transmissions per template (20)
+//     -t name         only this template (pwm, ppm, manchester)
+//     -j us           jitter of every pulse, standard deviation (15)
+//     -g rate         noise glitches per ms, while no transmission is on air (0)
+//     -c probability  a transmission collides with another one, weaker (0)
+//     -s seed         random seed (1)
+//     -p name=value   Signal parameter, by its json name (min_pulse_len, signal_end_timeout, min_preamble,
+//                     seek_timeout, min_raw_pulses, scan_high_time, poll_budget)
+//     -C micros_ns,digitalRead_ns,rssi_us   time spent by each call on the device (200,150,30)
+//     -o file         also write the results as JSON
+//
+// A packet is captured when a frame holds all its pulses but the trailing gap, in a row, each one within
+// 20% (60 us at least) of what was on air. A transmission is captured when one of its repeats is.
+// Timing error is measured on the pulses of captured packets, against the on air durations.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <Arduino.h> // after the standard headers, its min() and max() macros break them
+#include "1_Radio.h"
+#include "2_Signal.h"
+#include "RFLinkNative.h"
+
+using namespace RFLink;
+using Native::Edge;
+
+namespace
+{
+  typedef std::vector<unsigned long> Pulses; // durations in us, starting HIGH
+
+  struct Template
+  {
+    const char *name;
+    int repeats;
+    void (*generate)(std::mt19937 &rng, Pulses &packet); // one packet, ending with its trailing gap
+  };
+
+  // EV1527 like: 24 bits, 1:3 PWM, sync pulse and long gap between repeats
+  void generatePwm(std::mt19937 &rng, Pulses &packet)
+  {
+    for (int i = 0; i < 24; i++)
+    {
+      bool bit = rng() & 1;
+      packet.push_back(bit ? 1050 : 350);
+      packet.push_back(bit ? 350 : 1050);
+    }
+    packet.push_back(350);
+    packet.push_back(10850);
+  }
+
+  // Nexus like weather sensor: 36 bits, pulse position, repeats separated by gaps shorter than signal_end_timeout
+  void generatePpm(std::mt19937 &rng, Pulses &packet)
+  {
+    for (int i = 0; i < 36; i++)
+    {
+      packet.push_back(500);
+      packet.push_back((rng() & 1) ? 2000 : 1000);
+    }
+    packet.push_back(500);
+    packet.push_back(4000);
+  }
+
+  // Oregon V2.1 like: Manchester, 488 us half bits, preamble of ones then 64 random bits
+  void generateManchester(std::mt19937 &rng, Pulses &packet)
+  {
+    const unsigned long half = 488;
+    std::vector<bool> halves;
+    for (int i = 0; i < 24 + 64; i++)
+    {
+      bool bit = i < 24 || (rng() & 1);
+      halves.push_back(!bit);
+      halves.push_back(bit);
+    }
+
+    size_t i = 0;
+    while (!halves[i]) // a packet starts HIGH
+      i++;
+    for (; i < halves.size();)
+    {
+      bool level = halves[i];
+      unsigned long length = 0;
+      for (; i < halves.size() && halves[i] == level; i++)
+        length += half;
+      if (level || i < halves.size())
+        packet.push_back(length);
+    }
+    if (packet.size() % 2)
+      packet.push_back(10000);
+    else
+      packet.back() = 10000;
+  }
+
+  const Template templates[] = {
+      {"pwm", 5, generatePwm},
+      {"ppm", 6, generatePpm},
+      {"manchester", 2, generateManchester},
+  };
+
+  struct Packet
+  {
+    int transmission;
+    unsigned long start_us;
+    unsigned long end_us;
+    Pulses pulses; // on air, jitter included
+  };
+
+  struct Interval
+  {
+    unsigned long start_us;
+    unsigned long end_us;
+  };
+
+  struct RssiStep
+  {
+    unsigned long time_us;
+    float rssi;
+  };
+
+  struct Scenario
+  {
+    int transmissions = 20;
+    double jitter_us = 15;
+    double glitchRate_per_ms = 0;
+    double collisionProbability = 0;
+    unsigned long seed = 1;
+  } scenario;
+
+  struct Timeline
+  {
+    std::vector<Packet> packets;
+    std::vector<Edge> edges;
+    std::vector<RssiStep> rssi;
+    unsigned long end_us;
+  } timeline;
+
+  const float NOISE_FLOOR_DBM = -105;
+  const float SIGNAL_DBM = -60;
+  const float INTERFERER_DBM = -75;
+
+  std::mt19937 rssiNoise;
+
+  unsigned long microsCost_ns = 200;
+  unsigned long digitalReadCost_ns = 150;
+  unsigned long rssiCost_us = 30;
+
+  void addPacket(std::mt19937 &rng, const Template &protocol, unsigned long start_us, std::vector<Interval> &highs, Packet *packet)
+  {
+    std::normal_distribution<double> jitter(0, scenario.jitter_us);
+    Pulses ideal;
+    protocol.generate(rng, ideal);
+
+    unsigned long t = start_us;
+    for (size_t i = 0; i < ideal.size(); i++)
+    {
+      long pulse = (long)ideal[i] + (long)jitter(rng);
+      if (pulse < 1)
+        pulse = 1;
+      if (i % 2 == 0)
+        highs.push_back({t, t + pulse});
+      if (packet)
+        packet->pulses.push_back(pulse);
+      t += pulse;
+    }
+    if (packet)
+    {
+      packet->start_us = start_us;
+      packet->end_us = t;
+    }
+  }
+
+  unsigned long packetsLength(const Template &protocol, std::mt19937 &rng)
+  {
+    Pulses packet;
+    protocol.generate(rng, packet);
+    unsigned long length = 0;
+    for (unsigned long pulse : packet)
+      length += pulse;
+    return length * protocol.repeats;
+  }
+
+  /**
+   * Builds the receiver output: transmissions of protocol separated by idle time, OR'ed with colliding
+   * transmissions and XOR'ed with glitches. Glitches only happen between transmissions: while a carrier
+   * is received, the AGC of the receiver keeps noise below the data slicer threshold.
+   * */
+  void buildTimeline(const Template &protocol)
+  {
+    std::mt19937 rng(scenario.seed);
+    std::uniform_int_distribution<unsigned long> idle(30000, 80000);
+    std::uniform_real_distribution<double> chance(0, 1);
+
+    std::vector<Interval> signalHighs, interfererHighs, glitches, onAir;
+    timeline.packets.clear();
+
+    unsigned long t = 0;
+    for (int transmission = 0; transmission < scenario.transmissions; transmission++)
+    {
+      t += idle(rng);
+      unsigned long transmissionStart_us = t;
+      for (int r = 0; r < protocol.repeats; r++)
+      {
+        Packet packet;
+        packet.transmission = transmission;
+        addPacket(rng, protocol, t, signalHighs, &packet);
+        t = packet.end_us;
+        timeline.packets.push_back(packet);
+      }
+
+      if (chance(rng) < scenario.collisionProbability)
+      {
+        const Template &other = templates[rng() % (sizeof(templates) / sizeof(templates[0]))];
+        unsigned long length = t - transmissionStart_us;
+        unsigned long start_us = transmissionStart_us + (unsigned long)(chance(rng) * length);
+        unsigned long otherLength = packetsLength(other, rng);
+        start_us = start_us > otherLength / 2 ? start_us - otherLength / 2 : 0;
+        onAir.push_back({start_us, start_us + otherLength});
+        for (int r = 0; r < other.repeats; r++)
+        {
+          Packet packet;
+          addPacket(rng, other, start_us, interfererHighs, &packet);
+          start_us = packet.end_us;
+        }
+      }
+      onAir.push_back({transmissionStart_us, t});
+    }
+    timeline.end_us = t + 100000;
+
+    if (scenario.glitchRate_per_ms > 0)
+    {
+      std::exponential_distribution<double> spacing(scenario.glitchRate_per_ms / 1000.0);
+      std::uniform_int_distribution<unsigned long> width(10, 80);
+      for (double g = spacing(rng); g < timeline.end_us; g += spacing(rng))
+      {
+        Interval glitch = {(unsigned long)g, (unsigned long)g + width(rng)};
+        bool quiet = std::none_of(onAir.begin(), onAir.end(), [&](const Interval &i) {
+          return glitch.end_us > i.start_us && glitch.start_us < i.end_us;
+        });
+        if (quiet)
+          glitches.push_back(glitch);
+      }
+    }
+
+    // sweep all level changes
+    struct Event
+    {
+      unsigned long time_us;
+      int8_t kind; // 0: signal, 1: interferer, 2: glitch
+      int8_t delta;
+    };
+    std::vector<Event> events;
+    for (const Interval &i : signalHighs)
+      events.push_back({i.start_us, 0, 1}), events.push_back({i.end_us, 0, -1});
+    for (const Interval &i : interfererHighs)
+      events.push_back({i.start_us, 1, 1}), events.push_back({i.end_us, 1, -1});
+    for (const Interval &i : glitches)
+      events.push_back({i.start_us, 2, 1}), events.push_back({i.end_us, 2, -1});
+    std::stable_sort(events.begin(), events.end(), [](const Event &a, const Event &b) { return a.time_us < b.time_us; });
+
+    int active[3] = {0, 0, 0};
+    int level = LOW;
+    float rssi = NOISE_FLOOR_DBM;
+    timeline.edges.clear();
+    timeline.rssi.clear();
+    timeline.rssi.push_back({0, rssi});
+
+    for (size_t e = 0; e < events.size();)
+    {
+      unsigned long now_us = events[e].time_us;
+      for (; e < events.size() && events[e].time_us == now_us; e++)
+        active[events[e].kind] += events[e].delta;
+
+      int newLevel = ((active[0] > 0 || active[1] > 0) != (active[2] > 0)) ? HIGH : LOW;
+      if (newLevel != level)
+      {
+        timeline.edges.push_back({now_us, (uint8_t)newLevel});
+        level = newLevel;
+      }
+
+      float newRssi = active[0] > 0 ? SIGNAL_DBM : active[1] > 0 ? INTERFERER_DBM : NOISE_FLOOR_DBM;
+      if (newRssi != rssi)
+      {
+        timeline.rssi.push_back({now_us, newRssi});
+        rssi = newRssi;
+      }
+    }
+  }
+
+  float timelineRssi(unsigned long now_us)
+  {
+    static std::normal_distribution<float> noise(0, 1.5);
+    auto step = std::upper_bound(timeline.rssi.begin(), timeline.rssi.end(), now_us,
+                                 [](unsigned long t, const RssiStep &s) { return t < s.time_us; });
+    return (step - 1)->rssi + noise(rssiNoise);
+  }
+
+  struct Capture
+  {
+    unsigned long end_us;
+    Pulses pulses;
+  };
+
+  void storeCapture(std::vector<Capture> &captures)
+  {
+    Capture capture;
+    capture.end_us = micros();
+    for (int i = 1; i <= Signal::RawSignal.Number; i++)
+      capture.pulses.push_back((unsigned long)Signal::RawSignal.Pulses[i] * Signal::RawSignal.Multiply);
+    captures.push_back(capture);
+  }
+
+  void runSync(bool (*slicer)(), std::vector<Capture> &captures)
+  {
+    Native::setMicros(0);
+    Native::setCallCosts(microsCost_ns, digitalReadCost_ns);
+    Native::setPinTimeline(Radio::pins::RX_DATA, timeline.edges.data(), timeline.edges.size(), LOW);
+
+    while (micros() < timeline.end_us)
+    {
+      if (slicer())
+        storeCapture(captures);
+    }
+
+    Native::setPinTimeline(Radio::pins::RX_DATA, nullptr, 0);
+    Native::setCallCosts(0, 0);
+  }
+
+  bool legacy() { return Signal::FetchSignal_sync(); }
+  bool rssiAdvanced() { return Signal::FetchSignal_sync_rssi(); }
+  bool resumable() { return Signal::ResumableSlicer::poll(); }
+
+  void runEdges(std::vector<Capture> &captures)
+  {
+    Signal::ResumableSlicer::reset();
+    for (const Edge &edge : timeline.edges)
+    {
+      Native::setMicros(edge.time_us);
+      if (Signal::ResumableSlicer::feed(edge.level == HIGH, edge.time_us))
+        storeCapture(captures);
+    }
+    Native::setMicros(timeline.end_us);
+    if (Signal::ResumableSlicer::feed(timeline.edges.empty() ? false : timeline.edges.back().level == HIGH, timeline.end_us))
+      storeCapture(captures);
+  }
+
+  // What ScanEvent() does in async mode, as if the main loop polled it continuously
+  void pollAsync(unsigned long until_us, std::vector<Capture> &captures)
+  {
+    using namespace Signal::AsyncSignalScanner;
+
+    if (queue::isEmpty() && nextPulseTimeoutTime_us > 0 && nextPulseTimeoutTime_us < until_us)
+    {
+      Native::setMicros(nextPulseTimeoutTime_us + 1);
+      onPulseTimerTimeout();
+    }
+    while (queue::pop(Signal::RawSignal))
+      storeCapture(captures);
+  }
+
+  void runAsync(std::vector<Capture> &captures)
+  {
+    Native::setMicros(0);
+    Native::setPinLevel(Radio::pins::RX_DATA, LOW);
+    Signal::AsyncSignalScanner::enableAsyncReceiver();
+
+    for (const Edge &edge : timeline.edges)
+    {
+      pollAsync(edge.time_us, captures);
+      Native::setMicros(edge.time_us);
+      Native::setPinLevel(Radio::pins::RX_DATA, edge.level);
+    }
+    pollAsync(timeline.end_us, captures);
+
+    Signal::AsyncSignalScanner::disableAsyncReceiver();
+  }
+
+  bool pulseMatches(unsigned long captured, unsigned long expected)
+  {
+    unsigned long tolerance = max(60UL, expected / 5);
+    return captured + tolerance >= expected && captured <= expected + tolerance;
+  }
+
+  struct Result
+  {
+    const char *protocol;
+    const char *slicer;
+    int transmissions = 0;
+    int transmissionsCaptured = 0;
+    int packets = 0;
+    int packetsCaptured = 0;
+    int frames = 0;
+    int spuriousFrames = 0;
+    double absoluteError_us = 0; // mean
+    double bias_us = 0;          // mean of captured - on air
+  };
+
+  Result evaluate(const char *protocol, const char *slicer, const std::vector<Capture> &captures)
+  {
+    Result result;
+    result.protocol = protocol;
+    result.slicer = slicer;
+    result.transmissions = scenario.transmissions;
+    result.packets = timeline.packets.size();
+    result.frames = captures.size();
+
+    std::vector<bool> transmissionCaptured(scenario.transmissions, false);
+    std::vector<bool> frameUsed(captures.size(), false);
+    double errorSum = 0, biasSum = 0;
+    unsigned long measuredPulses = 0;
+
+    size_t firstCapture = 0;
+    for (const Packet &packet : timeline.packets)
+    {
+      const size_t length = packet.pulses.size() - 1; // the trailing gap ends the frame or is the next preamble
+      while (firstCapture < captures.size() && captures[firstCapture].end_us < packet.start_us)
+        firstCapture++;
+
+      bool found = false;
+      for (size_t c = firstCapture; c < captures.size() && !found; c++)
+      {
+        const Pulses &frame = captures[c].pulses;
+        for (size_t offset = 0; offset + length <= frame.size() && !found; offset++)
+        {
+          size_t i = 0;
+          while (i < length && pulseMatches(frame[offset + i], packet.pulses[i]))
+            i++;
+          if (i < length)
+            continue;
+
+          found = true;
+          frameUsed[c] = true;
+          for (i = 0; i < length; i++)
+          {
+            double error = (double)frame[offset + i] - (double)packet.pulses[i];
+            errorSum += fabs(error);
+            biasSum += error;
+          }
+          measuredPulses += length;
+        }
+      }
+
+      if (found)
+      {
+        result.packetsCaptured++;
+        transmissionCaptured[packet.transmission] = true;
+      }
+    }
+
+    for (bool captured : transmissionCaptured)
+      result.transmissionsCaptured += captured;
+    for (bool used : frameUsed)
+      result.spuriousFrames += !used;
+    if (measuredPulses)
+    {
+      result.absoluteError_us = errorSum / measuredPulses;
+      result.bias_us = biasSum / measuredPulses;
+    }
+    return result;
+  }
+
+  bool setParameter(const char *assignment)
+  {
+    struct
+    {
+      const char *name;
+      unsigned long *value;
+    } parameters[] = {
+        {"min_raw_pulses", &Signal::params::min_raw_pulses},
+        {"seek_timeout", &Signal::params::seek_timeout},
+        {"min_preamble", &Signal::params::min_preamble},
+        {"min_pulse_len", &Signal::params::min_pulse_len},
+        {"signal_end_timeout", &Signal::params::signal_end_timeout},
+        {"scan_high_time", &Signal::params::scan_high_time},
+        {"poll_budget", &Signal::params::poll_budget},
+    };
+
+    const char *equal = strchr(assignment, '=');
+    if (!equal)
+      return false;
+    for (auto &parameter : parameters)
+    {
+      if (strncmp(assignment, parameter.name, equal - assignment) == 0 && parameter.name[equal - assignment] == 0)
+      {
+        *parameter.value = strtoul(equal + 1, nullptr, 10);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  int usage(const char *program)
+  {
+    fprintf(stderr, "usage: %s [-n count] [-t template] [-j jitter_us] [-g glitches_per_ms] [-c collision_probability]\n"
+                    "          [-s seed] [-p name=value ...] [-C micros_ns,digitalRead_ns,rssi_us] [-o results.json]\n",
+            program);
+    return 2;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const char *only = nullptr;
+  const char *outputPath = nullptr;
+  std::vector<const char *> assignments;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (i + 1 >= argc || argv[i][0] != '-' || argv[i][2] != 0)
+      return usage(argv[0]);
+
+    const char *value = argv[++i];
+    switch (argv[i - 1][1])
+    {
+    case 'n':
+      scenario.transmissions = atoi(value);
+      break;
+    case 't':
+      only = value;
+      break;
+    case 'j':
+      scenario.jitter_us = atof(value);
+      break;
+    case 'g':
+      scenario.glitchRate_per_ms = atof(value);
+      break;
+    case 'c':
+      scenario.collisionProbability = atof(value);
+      break;
+    case 's':
+      scenario.seed = strtoul(value, nullptr, 10);
+      break;
+    case 'p':
+      assignments.push_back(value);
+      break;
+    case 'C':
+      if (sscanf(value, "%lu,%lu,%lu", &microsCost_ns, &digitalReadCost_ns, &rssiCost_us) != 3)
+        return usage(argv[0]);
+      break;
+    case 'o':
+      outputPath = value;
+      break;
+    default:
+      return usage(argv[0]);
+    }
+  }
+
+  Native::setSerialOutput(nullptr);
+  Native::setup();
+  for (const char *assignment : assignments)
+  {
+    if (!setParameter(assignment))
+    {
+      fprintf(stderr, "unknown parameter: %s\n", assignment);
+      return 2;
+    }
+  }
+  Native::setRssiSource(timelineRssi, rssiCost_us);
+
+  std::vector<Result> results;
+  for (const Template &protocol : templates)
+  {
+    if (only && strcmp(only, protocol.name) != 0)
+      continue;
+
+    buildTimeline(protocol);
+
+    struct
+    {
+      const char *name;
+      bool (*slicer)();
+    } syncSlicers[] = {{"Legacy", legacy}, {"RSSI_Advanced", rssiAdvanced}, {"Legacy_Resumable", resumable}};
+
+    for (auto &sync : syncSlicers)
+    {
+      std::vector<Capture> captures;
+      rssiNoise.seed(scenario.seed);
+      Signal::ResumableSlicer::reset();
+      runSync(sync.slicer, captures);
+      results.push_back(evaluate(protocol.name, sync.name, captures));
+    }
+
+    std::vector<Capture> captures;
+    runEdges(captures);
+    results.push_back(evaluate(protocol.name, "Resumable_Late", captures));
+
+    captures.clear();
+    runAsync(captures);
+    results.push_back(evaluate(protocol.name, "Async", captures));
+  }
+
+  printf("template    slicer            transmissions  packets     frames  spurious  |error| us  bias us\n");
+  for (const Result &r : results)
+  {
+    printf("%-10s  %-16s  %5d / %-5d  %4d / %-4d  %6d  %8d  %10.1f  %7.1f\n", r.protocol, r.slicer,
+           r.transmissionsCaptured, r.transmissions, r.packetsCaptured, r.packets, r.frames, r.spuriousFrames,
+           r.absoluteError_us, r.bias_us);
+  }
+
+  if (outputPath)
+  {
+    FILE *output = fopen(outputPath, "w");
+    if (!output)
+    {
+      perror(outputPath);
+      return 2;
+    }
+    fprintf(output, "{\n  \"scenario\": {\"transmissions\": %d, \"jitter_us\": %.1f, \"glitches_per_ms\": %.3f, \"collision_probability\": %.3f, \"seed\": %lu},\n",
+            scenario.transmissions, scenario.jitter_us, scenario.glitchRate_per_ms, scenario.collisionProbability, scenario.seed);
+    fprintf(output, "  \"results\": [");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      const Result &r = results[i];
+      fprintf(output, "%s\n    {\"template\": \"%s\", \"slicer\": \"%s\", \"transmissions\": %d, \"transmissions_captured\": %d, "
+                      "\"packets\": %d, \"packets_captured\": %d, \"frames\": %d, \"spurious_frames\": %d, "
+                      "\"success_rate\": %.4f, \"abs_error_us\": %.2f, \"bias_us\": %.2f}",
+              i ? "," : "", r.protocol, r.slicer, r.transmissions, r.transmissionsCaptured, r.packets, r.packetsCaptured,
+              r.frames, r.spuriousFrames, r.transmissions ? (double)r.transmissionsCaptured / r.transmissions : 0.0,
+              r.absoluteError_us, r.bias_us);
+    }
+    fprintf(output, "\n  ]\n}\n");
+    fclose(output);
+  }
+  return 0;
+}
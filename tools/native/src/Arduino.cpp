@@ -0,0 +1,253 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <Arduino.h>
+#include <time.h>
+#include "RFLinkNative.h"
+
+#define NATIVE_PIN_COUNT 64
+
+HardwareSerial Serial;
+
+namespace
+{
+  bool manualClock = false;
+  unsigned long long manualNanos = 0;
+  unsigned long microsCost_ns = 0;
+  unsigned long digitalReadCost_ns = 0;
+  struct timespec hostClockStart;
+  bool hostClockStarted = false;
+
+  int pinLevels[NATIVE_PIN_COUNT];
+  void (*pinRoutines[NATIVE_PIN_COUNT])();
+  int pinRoutineModes[NATIVE_PIN_COUNT];
+
+  struct PinTimeline
+  {
+    const RFLink::Native::Edge *edges;
+    size_t count;
+    size_t cursor; // first edge after the time of the last read
+    int initialLevel;
+  } pinTimelines[NATIVE_PIN_COUNT];
+
+  int timelineLevel(PinTimeline &timeline, unsigned long now_us)
+  {
+    if (timeline.cursor > 0 && timeline.edges[timeline.cursor - 1].time_us > now_us)
+      timeline.cursor = 0; // clock went back
+    while (timeline.cursor < timeline.count && timeline.edges[timeline.cursor].time_us <= now_us)
+      timeline.cursor++;
+    return timeline.cursor == 0 ? timeline.initialLevel : timeline.edges[timeline.cursor - 1].level;
+  }
+
+  FILE *serialOutput = stdout;
+
+  unsigned long hostMicros()
+  {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (!hostClockStarted)
+    {
+      hostClockStart = now;
+      hostClockStarted = true;
+    }
+    return (unsigned long)((now.tv_sec - hostClockStart.tv_sec) * 1000000LL + (now.tv_nsec - hostClockStart.tv_nsec) / 1000);
+  }
+
+  char *formatNumber(unsigned long value, bool negative, char *str, int base)
+  {
+    char *p = str;
+    if (negative)
+      *p++ = '-';
+    char *digits = p;
+    do
+    {
+      unsigned digit = value % base;
+      *p++ = digit < 10 ? '0' + digit : 'a' + digit - 10;
+      value /= base;
+    } while (value);
+    *p = 0;
+    for (char *end = p - 1; digits < end; digits++, end--)
+    {
+      char c = *digits;
+      *digits = *end;
+      *end = c;
+    }
+    return str;
+  }
+}
+
+char *itoa(int value, char *str, int base) { return ltoa(value, str, base); }
+char *ltoa(long value, char *str, int base) { return (base == 10 && value < 0) ? formatNumber(0 - (unsigned long)value, true, str, base) : formatNumber((unsigned long)value, false, str, base); }
+char *utoa(unsigned int value, char *str, int base) { return formatNumber(value, false, str, base); }
+char *ultoa(unsigned long value, char *str, int base) { return formatNumber(value, false, str, base); }
+
+unsigned long micros()
+{
+  if (!manualClock)
+    return hostMicros();
+  unsigned long now_us = manualNanos / 1000;
+  manualNanos += microsCost_ns;
+  return now_us;
+}
+
+unsigned long millis() { return micros() / 1000; }
+
+void delayMicroseconds(unsigned int us)
+{
+  if (manualClock)
+  {
+    manualNanos += us * 1000ULL;
+    return;
+  }
+  struct timespec duration = {(time_t)(us / 1000000), (long)(us % 1000000) * 1000};
+  nanosleep(&duration, nullptr);
+}
+
+void delay(unsigned long ms)
+{
+  while (ms--)
+    delayMicroseconds(1000);
+}
+
+void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t pin)
+{
+  if (pin >= NATIVE_PIN_COUNT)
+    return LOW;
+
+  PinTimeline &timeline = pinTimelines[pin];
+  if (!timeline.edges || !manualClock)
+    return pinLevels[pin];
+
+  int level = timelineLevel(timeline, manualNanos / 1000);
+  manualNanos += digitalReadCost_ns;
+  return level;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  if (pin < NATIVE_PIN_COUNT)
+    pinLevels[pin] = val ? HIGH : LOW;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode)
+{
+  if (pin < NATIVE_PIN_COUNT)
+  {
+    pinRoutines[pin] = isr;
+    pinRoutineModes[pin] = mode;
+  }
+}
+
+void detachInterrupt(uint8_t pin)
+{
+  if (pin < NATIVE_PIN_COUNT)
+    pinRoutines[pin] = nullptr;
+}
+
+void noInterrupts() {}
+void interrupts() {}
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+    n += write(*buffer++);
+  return n;
+}
+
+static size_t printFormatted(Print &output, const char *format, va_list args)
+{
+  char buffer[512];
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  if (length < 0)
+    return 0;
+  return output.write(buffer, (size_t)length < sizeof(buffer) ? length : sizeof(buffer) - 1);
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  size_t n = printFormatted(*this, format, args);
+  va_end(args);
+  return n;
+}
+
+size_t Print::printf_P(PGM_P format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  size_t n = printFormatted(*this, format, args);
+  va_end(args);
+  return n;
+}
+
+size_t HardwareSerial::write(uint8_t c) { return serialOutput ? fputc(c, serialOutput) != EOF : 1; }
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) { return serialOutput ? fwrite(buffer, 1, size, serialOutput) : size; }
+int HardwareSerial::available() { return 0; }
+int HardwareSerial::read() { return -1; }
+int HardwareSerial::peek() { return -1; }
+
+namespace RFLink
+{
+  namespace Native
+  {
+    void setMicros(unsigned long now_us)
+    {
+      manualClock = true;
+      manualNanos = now_us * 1000ULL;
+    }
+
+    void advanceMicros(unsigned long duration_us)
+    {
+      if (manualClock)
+        manualNanos += duration_us * 1000ULL;
+    }
+
+    void setCallCosts(unsigned long micros_ns, unsigned long digitalRead_ns)
+    {
+      microsCost_ns = micros_ns;
+      digitalReadCost_ns = digitalRead_ns;
+    }
+
+    void useHostClock()
+    {
+      manualClock = false;
+    }
+
+    void setPinLevel(uint8_t pin, int level)
+    {
+      if (pin >= NATIVE_PIN_COUNT)
+        return;
+
+      level = level ? HIGH : LOW;
+      int previous = pinLevels[pin];
+      pinLevels[pin] = level;
+
+      if (pinRoutines[pin] == nullptr || previous == level)
+        return;
+      int mode = pinRoutineModes[pin];
+      if (mode == CHANGE || (mode == RISING && level == HIGH) || (mode == FALLING && level == LOW))
+        pinRoutines[pin]();
+    }
+
+    void setPinTimeline(uint8_t pin, const Edge *edges, size_t count, int initialLevel)
+    {
+      if (pin >= NATIVE_PIN_COUNT)
+        return;
+      pinTimelines[pin] = {edges, count, 0, initialLevel ? HIGH : LOW};
+    }
+
+    void setSerialOutput(FILE *stream)
+    {
+      serialOutput = stream;
+    }
+  }
+}
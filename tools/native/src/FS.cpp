@@ -0,0 +1,97 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+#include <LittleFS.h>
+#include <sys/stat.h>
+#include "RFLinkNative.h"
+
+fs::FS LittleFS;
+
+namespace
+{
+  String fileSystemRoot(".");
+
+  String hostPath(const char *path)
+  {
+    String result(fileSystemRoot);
+    if (path[0] != '/')
+      result += '/';
+    result += path;
+    return result;
+  }
+}
+
+namespace fs
+{
+  int File::peek()
+  {
+    if (!handle)
+      return -1;
+    int c = fgetc(handle);
+    if (c != EOF)
+      ungetc(c, handle);
+    return c;
+  }
+
+  int File::available()
+  {
+    size_t current = position();
+    size_t total = size();
+    return total > current ? total - current : 0;
+  }
+
+  size_t File::size() const
+  {
+    struct stat info;
+    if (!handle || fstat(fileno(handle), &info) != 0)
+      return 0;
+    return info.st_size;
+  }
+
+  void File::close()
+  {
+    if (handle)
+      fclose(handle);
+    handle = nullptr;
+  }
+
+  bool FS::begin(bool)
+  {
+    return true;
+  }
+
+  File FS::open(const char *path, const char *mode)
+  {
+    return File(fopen(hostPath(path).c_str(), mode));
+  }
+
+  bool FS::exists(const char *path)
+  {
+    struct stat info;
+    return stat(hostPath(path).c_str(), &info) == 0;
+  }
+
+  bool FS::remove(const char *path)
+  {
+    return ::remove(hostPath(path).c_str()) == 0;
+  }
+
+  bool FS::rename(const char *pathFrom, const char *pathTo)
+  {
+    return ::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0;
+  }
+}
+
+namespace RFLink
+{
+  namespace Native
+  {
+    void setFileSystemRoot(const char *path)
+    {
+      fileSystemRoot = path;
+    }
+  }
+}
@@ -0,0 +1,238 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Stands in for the modules that are not part of the native build (RFLink.cpp, 1_Radio.cpp, 3_Serial.cpp, 11_Config.cpp):
+// output goes to Serial or to the host program, the radio is a plain receiver on a fake pin and
+// configuration items always hold their default value.
+
+#include <Arduino.h>
+#include "RFLink.h"
+#include "1_Radio.h"
+#include "2_Signal.h"
+#include "3_Serial.h"
+#include "4_Display.h"
+#include "5_Plugin.h"
+#include "11_Config.h"
+#include "14_Flex.h"
+#include "RFLinkNative.h"
+
+#ifndef NATIVE_PIN_RF_RX_DATA
+#define NATIVE_PIN_RF_RX_DATA 4
+#endif
+#ifndef NATIVE_PIN_RF_TX_DATA
+#define NATIVE_PIN_RF_TX_DATA 5
+#endif
+
+namespace
+{
+  float currentRssi = -50.0;
+  RFLink::Native::RssiSource rssiSource = nullptr;
+  unsigned long rssiReadCost_us = 0;
+  RFLink::Native::MessageSink messageSink = nullptr;
+}
+
+char InputBuffer_Serial[INPUT_COMMAND_SIZE];
+
+namespace RFLink
+{
+  char printBuf[300];
+
+  void sendMsgFromBuffer()
+  {
+    const EventRecord *event;
+    while ((event = outputQueue.peek()) != nullptr)
+    {
+      pbuffer[0] = 0;
+      formatEventText(*event, pbufferBuilder);
+      if (messageSink)
+        messageSink(pbuffer);
+      else
+        Serial.print(pbuffer);
+      outputQueue.pop();
+    }
+  }
+
+  void sendRawPrint(const char *buf, bool end_of_line)
+  {
+    Serial.print(buf);
+    if (end_of_line)
+      Serial.println();
+  }
+
+  void sendRawPrint(const __FlashStringHelper *buf, bool end_of_line)
+  {
+    Serial.print(buf);
+    if (end_of_line)
+      Serial.println();
+  }
+
+  void sendRawPrint(long n) { Serial.print(n); }
+  void sendRawPrint(unsigned long n) { Serial.print(n); }
+  void sendRawPrint(int n) { Serial.print(n); }
+  void sendRawPrint(unsigned int n) { Serial.print(n); }
+  void sendRawPrint(float f) { Serial.print(f); }
+  void sendRawPrint(char c) { Serial.write(c); }
+
+  namespace Radio
+  {
+    States current_State = Radio_OFF;
+
+    namespace pins
+    {
+      int8_t RX_DATA = NATIVE_PIN_RF_RX_DATA;
+      int8_t TX_DATA = NATIVE_PIN_RF_TX_DATA;
+    }
+
+    void set_Radio_mode(States new_state, bool)
+    {
+      current_State = new_state;
+    }
+
+    float getCurrentRssi()
+    {
+      if (!rssiSource)
+        return currentRssi;
+      float rssi = rssiSource(micros());
+      Native::advanceMicros(rssiReadCost_us);
+      return rssi;
+    }
+  }
+
+  namespace Config
+  {
+    ConfigItem::ConfigItem(const char *name, SectionId section, const char *default_value, void (*update_callback)(), bool can_be_null)
+    {
+      this->json_name = name;
+      this->section = section;
+      this->type = ConfigItemType::STRING_t;
+      this->update_callback = update_callback;
+      this->canBeNull = can_be_null;
+      this->defaultValue = (void *)default_value;
+    }
+
+    ConfigItem::ConfigItem(const char *name, SectionId section, long int default_value, void (*update_callback)(), bool can_be_null)
+    {
+      this->json_name = name;
+      this->section = section;
+      this->type = ConfigItemType::LONG_INT_t;
+      this->update_callback = update_callback;
+      this->canBeNull = can_be_null;
+      this->defaultValue = (void *)default_value;
+    }
+
+    ConfigItem::ConfigItem(const char *name, SectionId section, bool default_value, void (*update_callback)(), bool can_be_null)
+    {
+      this->json_name = name;
+      this->section = section;
+      this->type = ConfigItemType::BOOLEAN_t;
+      this->update_callback = update_callback;
+      this->canBeNull = can_be_null;
+      this->boolDefaultValue = default_value;
+    }
+
+    ConfigItem::ConfigItem()
+    {
+      this->json_name = nullptr;
+      this->section = SectionId::EOF_id;
+      this->type = ConfigItemType::EOF_t;
+      this->update_callback = nullptr;
+      this->canBeNull = false;
+    }
+
+    ConfigItem *findConfigItem(const char *name, SectionId section)
+    {
+      ConfigItem *lists[] = {&Signal::configItems[0], &Plugin::configItems[0], &Flex::configItems[0]};
+
+      for (ConfigItem *item : lists)
+      {
+        for (; !item->typeIsEOF(); item++)
+        {
+          if (item->section == section && strcmp(item->json_name, name) == 0)
+            return item;
+        }
+      }
+
+      return nullptr;
+    }
+  }
+
+  namespace Native
+  {
+    void setup()
+    {
+      Signal::setup();
+      Flex::setup();
+      PluginInit();
+      PluginTXInit();
+      Radio::set_Radio_mode(Radio::Radio_RX);
+    }
+
+    void setRssi(float rssi)
+    {
+      currentRssi = rssi;
+    }
+
+    void setRssiSource(RssiSource source, unsigned long readCost_us)
+    {
+      rssiSource = source;
+      rssiReadCost_us = readCost_us;
+    }
+
+    void setMessageSink(MessageSink sink)
+    {
+      messageSink = sink;
+    }
+
+    bool loadPulses(const char *text, Signal::RawSignalStruct &signal)
+    {
+      const char *list = strstr(text, "Pulses(uSec)=");
+      if (list)
+        list += strlen("Pulses(uSec)=");
+      else if ((list = strstr(text, "temp[]={")) != nullptr)
+        list += strlen("temp[]={");
+      else
+        list = text;
+      while (isspace(*list))
+        list++;
+
+      signal.Number = 0;
+      signal.Repeats = 0;
+      signal.Delay = 0;
+      signal.Multiply = Signal::params::sample_rate;
+      signal.Time = millis();
+      signal.rssi = currentRssi;
+      signal.endReason = Signal::EndReasons::Unknown;
+
+      while (isdigit(*list))
+      {
+        if (signal.Number >= RAW_BUFFER_SIZE)
+          return false;
+
+        unsigned long duration = strtoul(list, (char **)&list, 10);
+        signal.Pulses[++signal.Number] = duration / signal.Multiply;
+
+        if (*list != ',')
+          break;
+        list++;
+      }
+
+      return signal.Number > 1;
+    }
+
+    bool decodeRawSignal()
+    {
+      Signal::counters::receivedSignalsCount++;
+      Signal::RawSignal.readyForDecoder = true;
+      bool decoded = PluginRXCall(0, 0) != 0;
+      if (decoded)
+        Signal::counters::successfullyDecodedSignalsCount++;
+      Signal::RawSignal.readyForDecoder = false;
+
+      sendMsgFromBuffer();
+      return decoded;
+    }
+  }
+}
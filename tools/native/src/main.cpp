@@ -0,0 +1,75 @@
+// ************************************* //
+// * Arduino Project RFLink32        * //
+// * https://github.com/couin3/RFLink  * //
+// * More details in RFLink.ino file   * //
+// ************************************* //
+
+// Decodes captures on the host: every line holding pulses, read from the files given on the
+// command line or from stdin, goes through the plugins and the decoded messages are printed.
+//
+//   .pio/build/native/program [-v] [capture.txt ...]
+//
+// -v keeps what plugins print on Serial, which is discarded by default.
+
+#include <Arduino.h>
+#include "2_Signal.h"
+#include "RFLinkNative.h"
+
+using namespace RFLink;
+
+static FILE *messagesOutput = stdout;
+
+static void printMessage(const char *message)
+{
+  fputs(message, messagesOutput);
+}
+
+static void decodeStream(FILE *input, unsigned long &lines, unsigned long &decoded)
+{
+  static char line[16384];
+
+  while (fgets(line, sizeof(line), input))
+  {
+    if (!Native::loadPulses(line, Signal::RawSignal))
+      continue;
+
+    lines++;
+    if (Native::decodeRawSignal())
+      decoded++;
+    else
+      fprintf(messagesOutput, "-- no plugin for %d pulses\n", Signal::RawSignal.Number);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int first = 1;
+  bool verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+  if (verbose)
+    first++;
+
+  Native::setSerialOutput(verbose ? stdout : nullptr);
+  Native::setMessageSink(printMessage);
+  Native::setup();
+
+  unsigned long lines = 0;
+  unsigned long decoded = 0;
+
+  if (first >= argc)
+    decodeStream(stdin, lines, decoded);
+
+  for (int i = first; i < argc; i++)
+  {
+    FILE *input = fopen(argv[i], "r");
+    if (!input)
+    {
+      perror(argv[i]);
+      return 2;
+    }
+    decodeStream(input, lines, decoded);
+    fclose(input);
+  }
+
+  fprintf(stderr, "%lu signals, %lu decoded\n", lines, decoded);
+  return 0;
+}